@@ -0,0 +1,110 @@
+#include "allocation.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> g_count{0};
+std::atomic<std::size_t> g_bytes{0};
+std::atomic<std::size_t> g_current{0};
+std::atomic<std::size_t> g_peak{0};
+
+// every allocation is prefixed with its size, so that operator delete knows how many bytes are freed
+constexpr std::size_t header = alignof(std::max_align_t);
+
+void* allocate(std::size_t size) {
+  auto* base = static_cast<char*>(std::malloc(size + header));
+  if (base == nullptr) {
+    throw std::bad_alloc();
+  }
+  *reinterpret_cast<std::size_t*>(base) = size;
+
+  g_count.fetch_add(1, std::memory_order_relaxed);
+  g_bytes.fetch_add(size, std::memory_order_relaxed);
+  const auto current = g_current.fetch_add(size, std::memory_order_relaxed) + size;
+
+  auto peak = g_peak.load(std::memory_order_relaxed);
+  while (peak < current && !g_peak.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+  }
+
+  return base + header;
+}
+
+void deallocate(void* ptr) noexcept {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto* base = static_cast<char*>(ptr) - header;
+  g_current.fetch_sub(*reinterpret_cast<std::size_t*>(base), std::memory_order_relaxed);
+  std::free(base);
+}
+
+} // namespace
+
+namespace allocation {
+
+statistics snapshot() noexcept {
+  return {g_count.load(std::memory_order_relaxed),
+          g_bytes.load(std::memory_order_relaxed),
+          g_current.load(std::memory_order_relaxed),
+          g_peak.load(std::memory_order_relaxed)};
+}
+
+void reset_peak() noexcept {
+  g_peak.store(g_current.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+} // namespace allocation
+
+/*------------------------ replaceable global operators ----------------------*/
+// the over-aligned variants are not replaced, they neither call these nor are counted
+
+void* operator new(std::size_t size) {
+  return allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+  return allocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+  try {
+    return allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void* ptr) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+  deallocate(ptr);
+}
@@ -0,0 +1,57 @@
+#ifndef JFLECT_BENCHMARK_ALLOCATION_HPP_
+#define JFLECT_BENCHMARK_ALLOCATION_HPP_
+#include <algorithm>
+#include <cstddef>
+
+#include "benchmark/benchmark.h"
+
+/**
+ * Heap statistics which are collected by the replaced global operator new and operator delete (allocation.cpp).
+ */
+namespace allocation {
+
+struct statistics {
+  std::size_t count;   // number of allocations
+  std::size_t bytes;   // sum of all allocated bytes
+  std::size_t current; // bytes which are currently allocated
+  std::size_t peak;    // maximum of current since the last reset_peak()
+};
+
+statistics snapshot() noexcept;
+
+// sets the peak to the currently allocated bytes
+void reset_peak() noexcept;
+
+/**
+ * @brief measures the allocations from its construction to report()
+ *
+ * Construct it right in front of the benchmark loop, after the input has been prepared.
+ */
+class counter {
+public:
+  counter() noexcept : m_begin((reset_peak(), snapshot())) {}
+
+  /**
+   * @brief adds the counters allocs and bytes_allocated (per iteration) and peak_heap (bytes above the heap size at
+   * construction)
+   */
+  void report(benchmark::State& state) const {
+    const auto end = snapshot();
+
+    state.counters["allocs"] =
+        benchmark::Counter(static_cast<double>(end.count - m_begin.count), benchmark::Counter::kAvgIterations);
+    state.counters["bytes_allocated"] = benchmark::Counter(static_cast<double>(end.bytes - m_begin.bytes),
+                                                           benchmark::Counter::kAvgIterations,
+                                                           benchmark::Counter::OneK::kIs1024);
+    state.counters["peak_heap"] = benchmark::Counter(static_cast<double>(std::max(end.peak, m_begin.current) -
+                                                                         m_begin.current),
+                                                     benchmark::Counter::kDefaults,
+                                                     benchmark::Counter::OneK::kIs1024);
+  }
+
+private:
+  statistics m_begin;
+};
+
+} // namespace allocation
+#endif // JFLECT_BENCHMARK_ALLOCATION_HPP_
@@ -1,6 +1,12 @@
 #include "benchmark/benchmark.h"
 
+#include "allocation.hpp"
+
 #include "jflect/jflect.hpp"
+#include "jflect/msgpack.hpp"
+
+#include <string>
+#include <vector>
 
 using T = std::tuple<int, double, std::array<int, 3>>;
 
@@ -8,10 +14,12 @@ constexpr auto input = std::string_view("[42,33.2,[1,2,3]]");
 // constexpr auto output = T{42, 33.2, std::array{1, 2, 3}};
 
 static void BM_jflect_read_int(benchmark::State& state) {
+  allocation::counter allocations;
   for (auto _ : state) {
     T result = jflect::read<T>(input);
     benchmark::DoNotOptimize(result);
   }
+  allocations.report(state);
 }
 
 /*
@@ -59,7 +67,72 @@ static void BM_native_read_int(benchmark::State& state) {
 }
 */
 
+/*----------------------------- json vs msgpack ------------------------------*/
+
+enum struct side { buy, sell };
+
+struct Order {
+  std::string id;
+  side direction;
+  long quantity;
+  double price;
+  std::vector<int> fills;
+};
+
+static const auto orders = [] {
+  std::vector<Order> result;
+  for (int i = 0; i < 1000; ++i) {
+    const auto direction = i % 2 == 0 ? side::buy : side::sell;
+    result.push_back(Order{"order-" + std::to_string(i), direction, i * 100, i * 0.25, {i, i + 1}});
+  }
+  return result;
+}();
+
+static void BM_json_write_orders(benchmark::State& state) {
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = jflect::write(orders);
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+}
+
+static void BM_msgpack_write_orders(benchmark::State& state) {
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = jflect::msgpack::write(orders);
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+}
+
+static void BM_json_read_orders(benchmark::State& state) {
+  const auto json = jflect::write(orders);
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = jflect::read<std::vector<Order>>(json);
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(json)));
+}
+
+static void BM_msgpack_read_orders(benchmark::State& state) {
+  const auto msgpack = jflect::msgpack::write(orders);
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = jflect::msgpack::read<std::vector<Order>>(msgpack);
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(msgpack)));
+}
+
 BENCHMARK(BM_jflect_read_int);
 // BENCHMARK(BM_native_read_int);
+BENCHMARK(BM_json_write_orders);
+BENCHMARK(BM_msgpack_write_orders);
+BENCHMARK(BM_json_read_orders);
+BENCHMARK(BM_msgpack_read_orders);
 
 BENCHMARK_MAIN();
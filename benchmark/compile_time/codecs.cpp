@@ -0,0 +1,6 @@
+#include "jflect/jflect.hpp"
+#include "schema.hpp"
+
+JFLECT_DEFINE_CODEC(schema::Order)
+JFLECT_DEFINE_CODEC(schema::Catalog)
+JFLECT_DEFINE_CODEC(schema::Report)
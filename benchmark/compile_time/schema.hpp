@@ -0,0 +1,168 @@
+#ifndef JFLECT_BENCHMARK_COMPILE_TIME_SCHEMA_HPP_
+#define JFLECT_BENCHMARK_COMPILE_TIME_SCHEMA_HPP_
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+/**
+ * A schema of nested structs which is read and written by every translation unit of the compile time benchmark.
+ *
+ * COMPILE_TIME_CODEC selects how: 0 instantiates jflect::read/write in each of them, 1 calls jflect::codec which is
+ * instantiated once in codecs.cpp.
+ */
+namespace schema {
+
+enum struct Currency { eur, usd, gbp, chf, jpy };
+enum struct State { created, paid, shipped, delivered, returned, cancelled };
+
+struct Money {
+  std::int64_t cents;
+  Currency currency;
+};
+
+struct Coordinates {
+  double latitude;
+  double longitude;
+};
+
+struct Address {
+  std::string street;
+  std::string city;
+  std::string zip;
+  std::string country;
+  std::optional<Coordinates> location;
+};
+
+struct Contact {
+  std::string email;
+  std::optional<std::string> phone;
+  bool newsletter;
+};
+
+struct Customer {
+  std::int64_t id;
+  std::string name;
+  Contact contact;
+  std::vector<Address> addresses;
+  std::map<std::string, std::string> attributes;
+};
+
+struct Dimensions {
+  double width;
+  double height;
+  double depth;
+  double weight;
+};
+
+struct Price {
+  Money net;
+  Money gross;
+  double tax_rate;
+};
+
+struct Product {
+  std::string sku;
+  std::string title;
+  std::vector<std::string> tags;
+  Dimensions dimensions;
+  Price price;
+  std::optional<std::string> description;
+};
+
+struct Discount {
+  std::string code;
+  std::variant<double, Money> value;
+};
+
+struct Line {
+  Product product;
+  std::uint32_t quantity;
+  std::vector<Discount> discounts;
+};
+
+struct Parcel {
+  std::string carrier;
+  std::string tracking;
+  Dimensions dimensions;
+  std::vector<std::int64_t> lines;
+};
+
+struct Event {
+  std::int64_t timestamp;
+  State state;
+  std::optional<std::string> note;
+};
+
+struct Payment {
+  std::string method;
+  Money amount;
+  std::optional<std::string> reference;
+};
+
+struct Order {
+  std::int64_t id;
+  Customer customer;
+  Address shipping;
+  Address billing;
+  std::vector<Line> lines;
+  std::vector<Parcel> parcels;
+  std::vector<Payment> payments;
+  std::vector<Event> history;
+  State state;
+};
+
+struct Warehouse {
+  std::string name;
+  Address address;
+  std::map<std::string, std::uint32_t> stock;
+  std::array<Coordinates, 4> area;
+};
+
+struct Catalog {
+  std::string name;
+  std::vector<Product> products;
+  std::vector<Warehouse> warehouses;
+};
+
+struct Report {
+  std::int64_t from;
+  std::int64_t to;
+  std::vector<Order> orders;
+  std::map<std::string, Money> revenue;
+};
+
+} // namespace schema
+
+#if COMPILE_TIME_CODEC
+#include "jflect/codec.hpp"
+
+JFLECT_DECLARE_CODEC(schema::Order)
+JFLECT_DECLARE_CODEC(schema::Catalog)
+JFLECT_DECLARE_CODEC(schema::Report)
+
+namespace schema {
+
+template<class T>
+std::string roundtrip(std::string_view sv) {
+  return jflect::codec<T>::write(jflect::codec<T>::read(sv));
+}
+
+} // namespace schema
+#else
+#include "jflect/jflect.hpp"
+
+namespace schema {
+
+template<class T>
+std::string roundtrip(std::string_view sv) {
+  return jflect::write(jflect::read<T>(sv));
+}
+
+} // namespace schema
+#endif
+
+#endif // JFLECT_BENCHMARK_COMPILE_TIME_SCHEMA_HPP_
@@ -0,0 +1,89 @@
+#include "benchmark/benchmark.h"
+
+#include "allocation.hpp"
+#include "corpus.hpp"
+#include "jflect/format.hpp"
+#include "jflect/jflect.hpp"
+#include "jflect/validate.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+// the throughput is reported as bytes_per_second of json text
+template<class Corpus>
+static void BM_jflect_read(benchmark::State& state) {
+  const auto& data = corpus::dataset<Corpus>::get();
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = jflect::read<typename Corpus::type>(data.json);
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(data.json)));
+}
+
+template<class Corpus>
+static void BM_jflect_write(benchmark::State& state) {
+  const auto& data = corpus::dataset<Corpus>::get();
+  std::string result;
+  allocation::counter allocations;
+  for (auto _ : state) {
+    result.clear();
+    jflect::write_to(std::back_inserter(result), data.value);
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(data.json)));
+}
+
+template<class Corpus>
+static void BM_jflect_validate(benchmark::State& state) {
+  const auto& data = corpus::dataset<Corpus>::get();
+  for (auto _ : state) {
+    auto result = jflect::validate(data.json);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(data.json)));
+}
+
+// compacts the pretty-printed corpus, as forwarded third party json would be
+template<class Corpus>
+static void BM_jflect_minify(benchmark::State& state) {
+  const auto pretty = jflect::reformat(corpus::dataset<Corpus>::get().json);
+  std::string result;
+  for (auto _ : state) {
+    result.clear();
+    jflect::minify_to(std::back_inserter(result), pretty);
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(pretty)));
+}
+
+BENCHMARK_TEMPLATE(BM_jflect_read, corpus::tweets);
+BENCHMARK_TEMPLATE(BM_jflect_read, corpus::geometry);
+BENCHMARK_TEMPLATE(BM_jflect_read, corpus::nesting);
+BENCHMARK_TEMPLATE(BM_jflect_read, corpus::wide);
+BENCHMARK_TEMPLATE(BM_jflect_read, corpus::large_map);
+BENCHMARK_TEMPLATE(BM_jflect_read, corpus::enums);
+
+BENCHMARK_TEMPLATE(BM_jflect_write, corpus::tweets);
+BENCHMARK_TEMPLATE(BM_jflect_write, corpus::geometry);
+BENCHMARK_TEMPLATE(BM_jflect_write, corpus::nesting);
+BENCHMARK_TEMPLATE(BM_jflect_write, corpus::wide);
+BENCHMARK_TEMPLATE(BM_jflect_write, corpus::large_map);
+BENCHMARK_TEMPLATE(BM_jflect_write, corpus::enums);
+
+BENCHMARK_TEMPLATE(BM_jflect_validate, corpus::tweets);
+BENCHMARK_TEMPLATE(BM_jflect_validate, corpus::geometry);
+BENCHMARK_TEMPLATE(BM_jflect_validate, corpus::nesting);
+BENCHMARK_TEMPLATE(BM_jflect_validate, corpus::wide);
+BENCHMARK_TEMPLATE(BM_jflect_validate, corpus::large_map);
+BENCHMARK_TEMPLATE(BM_jflect_validate, corpus::enums);
+
+BENCHMARK_TEMPLATE(BM_jflect_minify, corpus::tweets);
+BENCHMARK_TEMPLATE(BM_jflect_minify, corpus::geometry);
+BENCHMARK_TEMPLATE(BM_jflect_minify, corpus::nesting);
+BENCHMARK_TEMPLATE(BM_jflect_minify, corpus::wide);
+BENCHMARK_TEMPLATE(BM_jflect_minify, corpus::large_map);
+BENCHMARK_TEMPLATE(BM_jflect_minify, corpus::enums);
@@ -0,0 +1,244 @@
+#ifndef JFLECT_BENCHMARK_CORPUS_HPP_
+#define JFLECT_BENCHMARK_CORPUS_HPP_
+#include <array>
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "jflect/jflect.hpp"
+
+/**
+ * Generated documents which model typical shapes of json. Every corpus is a type with
+ *
+ * - type: the c++ type which is read and written
+ * - generate(): creates the value from a fixed seed, so every run (and every implementation) sees the same data
+ *
+ * Nothing is downloaded, the json text is written by jflect::write once per process.
+ */
+namespace corpus {
+
+/*------------------------------- tweets -------------------------------------*/
+// string heavy: short texts and names, few numbers
+
+struct User {
+  std::string screen_name;
+  std::string name;
+  std::string location;
+  std::int64_t followers;
+  bool verified;
+};
+
+struct Tweet {
+  std::int64_t id;
+  std::string created_at;
+  std::string text;
+  User user;
+  std::vector<std::string> hashtags;
+  std::int64_t retweets;
+};
+
+/*------------------------------ geometry ------------------------------------*/
+// number heavy: long arrays of floating points
+
+struct Feature {
+  std::string name;
+  std::vector<std::array<double, 2>> coordinates;
+};
+
+/*------------------------------- nesting ------------------------------------*/
+// deep nesting: chains of objects and arrays
+
+struct Node {
+  std::int64_t value;
+  std::vector<Node> children;
+};
+
+/*-------------------------------- wide --------------------------------------*/
+// many members per struct, which stresses the member lookup
+
+struct Wide {
+  std::int32_t i0, i1, i2, i3, i4, i5, i6, i7;
+  double d0, d1, d2, d3, d4, d5, d6, d7;
+  bool b0, b1, b2, b3, b4, b5, b6, b7;
+  std::string s0, s1, s2, s3, s4, s5, s6, s7;
+};
+
+/*-------------------------------- enums -------------------------------------*/
+
+enum struct Status { pending, active, suspended, closed, archived };
+enum struct Priority { low, medium, high, critical };
+
+struct Ticket {
+  std::int64_t id;
+  Status status;
+  Priority priority;
+  std::vector<Status> history;
+};
+
+/*----------------------------------------------------------------------------*/
+
+namespace detail {
+
+inline constexpr std::uint64_t seed = 0x6a666c656374; // "jflect"
+
+inline constexpr std::array words = {"lorem", "ipsum", "dolor",  "sit",    "amet",   "consectetur", "adipiscing",
+                                     "elit",  "sed",   "do",     "tempor", "magna",  "aliqua",      "enim",
+                                     "minim", "quis",  "nostrud", "ullamco", "laboris", "nisi",      "commodo"};
+
+inline std::string sentence(std::mt19937_64& rng, std::size_t wordCount) {
+  std::string result;
+  for (std::size_t i = 0; i < wordCount; ++i) {
+    if (i != 0) {
+      result += ' ';
+    }
+    result += words[rng() % std::size(words)];
+  }
+  return result;
+}
+
+inline Node chain(std::mt19937_64& rng, std::size_t depth) {
+  auto node = Node{static_cast<std::int64_t>(rng() % 1000), {}};
+  if (depth > 0) {
+    node.children.push_back(chain(rng, depth - 1));
+    node.children.push_back(Node{static_cast<std::int64_t>(rng() % 1000), {}}); // a leaf at every level
+  }
+  return node;
+}
+
+} // namespace detail
+
+struct tweets {
+  using type = std::vector<Tweet>;
+
+  static type generate() {
+    std::mt19937_64 rng(detail::seed);
+    type result;
+    for (std::int64_t i = 0; i < 2000; ++i) {
+      auto user = User{"user_" + std::to_string(rng() % 10000),
+                       detail::sentence(rng, 2),
+                       detail::sentence(rng, 1 + rng() % 3),
+                       static_cast<std::int64_t>(rng() % 1000000),
+                       rng() % 10 == 0};
+      auto hashtags = std::vector<std::string>(rng() % 4);
+      for (auto& hashtag : hashtags) {
+        hashtag = detail::words[rng() % std::size(detail::words)];
+      }
+      result.push_back(Tweet{1500000000000000000 + i,
+                             "Mon Oct 19 10:" + std::to_string(10 + rng() % 50) + ":00 +0000 2026",
+                             detail::sentence(rng, 5 + rng() % 20),
+                             std::move(user),
+                             std::move(hashtags),
+                             static_cast<std::int64_t>(rng() % 5000)});
+    }
+    return result;
+  }
+};
+
+struct geometry {
+  using type = std::vector<Feature>;
+
+  static type generate() {
+    std::mt19937_64 rng(detail::seed);
+    std::uniform_real_distribution<double> longitude(-180.0, 180.0);
+    std::uniform_real_distribution<double> latitude(-90.0, 90.0);
+    type result;
+    for (int i = 0; i < 100; ++i) {
+      auto feature = Feature{"feature_" + std::to_string(i), {}};
+      for (int j = 0; j < 500; ++j) {
+        feature.coordinates.push_back({longitude(rng), latitude(rng)});
+      }
+      result.push_back(std::move(feature));
+    }
+    return result;
+  }
+};
+
+struct nesting {
+  using type = std::vector<Node>;
+
+  static type generate() {
+    std::mt19937_64 rng(detail::seed);
+    type result;
+    for (int i = 0; i < 50; ++i) {
+      result.push_back(detail::chain(rng, 100));
+    }
+    return result;
+  }
+};
+
+struct wide {
+  using type = std::vector<Wide>;
+
+  static type generate() {
+    std::mt19937_64 rng(detail::seed);
+    std::uniform_real_distribution<double> real(-1000.0, 1000.0);
+    const auto integer = [&rng] { return static_cast<std::int32_t>(rng() % 100000); };
+    const auto boolean = [&rng] { return rng() % 2 == 0; };
+    const auto string = [&rng] { return detail::sentence(rng, 2); };
+
+    type result;
+    for (int i = 0; i < 1000; ++i) {
+      // clang-format off
+      result.push_back(Wide{integer(), integer(), integer(), integer(), integer(), integer(), integer(), integer(),
+                            real(rng), real(rng), real(rng), real(rng), real(rng), real(rng), real(rng), real(rng),
+                            boolean(), boolean(), boolean(), boolean(), boolean(), boolean(), boolean(), boolean(),
+                            string(), string(), string(), string(), string(), string(), string(), string()});
+      // clang-format on
+    }
+    return result;
+  }
+};
+
+struct large_map {
+  using type = std::map<std::string, std::int64_t>;
+
+  static type generate() {
+    std::mt19937_64 rng(detail::seed);
+    type result;
+    for (int i = 0; i < 20000; ++i) {
+      result.emplace("key_" + std::to_string(rng()), static_cast<std::int64_t>(rng() % 1000000));
+    }
+    return result;
+  }
+};
+
+struct enums {
+  using type = std::vector<Ticket>;
+
+  static type generate() {
+    std::mt19937_64 rng(detail::seed);
+    const auto status = [&rng] { return static_cast<Status>(rng() % 5); };
+    type result;
+    for (std::int64_t i = 0; i < 10000; ++i) {
+      auto history = std::vector<Status>(rng() % 6);
+      for (auto& s : history) {
+        s = status();
+      }
+      result.push_back(Ticket{i, status(), static_cast<Priority>(rng() % 4), std::move(history)});
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief the generated value of a corpus and its json text, created on first use
+ */
+template<class Corpus>
+struct dataset {
+  typename Corpus::type value;
+  std::string json;
+
+  static const dataset& get() {
+    static const auto instance = [] {
+      auto value = Corpus::generate();
+      auto json = jflect::write(value);
+      return dataset{std::move(value), std::move(json)};
+    }();
+    return instance;
+  }
+};
+
+} // namespace corpus
+#endif // JFLECT_BENCHMARK_CORPUS_HPP_
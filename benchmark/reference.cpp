@@ -0,0 +1,81 @@
+#include "benchmark/benchmark.h"
+
+#include "allocation.hpp"
+#include "corpus.hpp"
+
+#include "nlohmann/json.hpp"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * The same decode and encode with nlohmann/json as reference implementation.
+ * Built with -DJFLECT_BENCHMARK_REFERENCE=ON, the library is fetched while configuring, not at benchmark time.
+ */
+namespace corpus {
+
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(User, screen_name, name, location, followers, verified)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Tweet, id, created_at, text, user, hashtags, retweets)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Feature, name, coordinates)
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Node, value, children)
+// clang-format off
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Wide,
+                                   i0, i1, i2, i3, i4, i5, i6, i7,
+                                   d0, d1, d2, d3, d4, d5, d6, d7,
+                                   b0, b1, b2, b3, b4, b5, b6, b7,
+                                   s0, s1, s2, s3, s4, s5, s6, s7)
+// clang-format on
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(Ticket, id, status, priority, history)
+
+NLOHMANN_JSON_SERIALIZE_ENUM(Status,
+                             {{Status::pending, "pending"},
+                              {Status::active, "active"},
+                              {Status::suspended, "suspended"},
+                              {Status::closed, "closed"},
+                              {Status::archived, "archived"}})
+
+NLOHMANN_JSON_SERIALIZE_ENUM(Priority,
+                             {{Priority::low, "low"},
+                              {Priority::medium, "medium"},
+                              {Priority::high, "high"},
+                              {Priority::critical, "critical"}})
+
+} // namespace corpus
+
+template<class Corpus>
+static void BM_nlohmann_read(benchmark::State& state) {
+  const auto& data = corpus::dataset<Corpus>::get();
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = nlohmann::json::parse(data.json).template get<typename Corpus::type>();
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(data.json)));
+}
+
+template<class Corpus>
+static void BM_nlohmann_write(benchmark::State& state) {
+  const auto& data = corpus::dataset<Corpus>::get();
+  allocation::counter allocations;
+  for (auto _ : state) {
+    auto result = nlohmann::json(data.value).dump();
+    benchmark::DoNotOptimize(result);
+  }
+  allocations.report(state);
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * std::size(data.json)));
+}
+
+BENCHMARK_TEMPLATE(BM_nlohmann_read, corpus::tweets);
+BENCHMARK_TEMPLATE(BM_nlohmann_read, corpus::geometry);
+BENCHMARK_TEMPLATE(BM_nlohmann_read, corpus::nesting);
+BENCHMARK_TEMPLATE(BM_nlohmann_read, corpus::wide);
+BENCHMARK_TEMPLATE(BM_nlohmann_read, corpus::large_map);
+BENCHMARK_TEMPLATE(BM_nlohmann_read, corpus::enums);
+
+BENCHMARK_TEMPLATE(BM_nlohmann_write, corpus::tweets);
+BENCHMARK_TEMPLATE(BM_nlohmann_write, corpus::geometry);
+BENCHMARK_TEMPLATE(BM_nlohmann_write, corpus::nesting);
+BENCHMARK_TEMPLATE(BM_nlohmann_write, corpus::wide);
+BENCHMARK_TEMPLATE(BM_nlohmann_write, corpus::large_map);
+BENCHMARK_TEMPLATE(BM_nlohmann_write, corpus::enums);
@@ -0,0 +1,58 @@
+#ifndef JFLECT_CODEC_HPP_
+#define JFLECT_CODEC_HPP_
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+
+/**
+ * Explicit instantiation of the (de)serialization of a type, so that its read_to/write_to tree is compiled in one
+ * translation unit instead of every one that reads or writes it.
+ *
+ * // order.hpp, included everywhere, does not need jflect.hpp
+ * #include "jflect/codec.hpp"
+ * struct Order { ... };
+ * JFLECT_DECLARE_CODEC(Order)
+ *
+ * // order.cpp, the only translation unit which instantiates the codec
+ * #include "jflect/jflect.hpp"
+ * #include "order.hpp"
+ * JFLECT_DEFINE_CODEC(Order)
+ *
+ * // anywhere else
+ * const auto order = jflect::codec<Order>::read(json);
+ */
+namespace jflect {
+
+/**
+ * @brief the result of write_to_buffer
+ */
+struct buffer_result {
+  std::size_t size; // the size of the json, which is larger than the buffer on overflow
+  bool overflow;    // the json did not fit, the buffer holds its first bytes
+
+  constexpr explicit operator bool() const noexcept { return !overflow; }
+};
+
+/**
+ * @brief reads and writes T through functions which are not inline, defined in jflect.hpp
+ *
+ * Without a declared codec every call is instantiated implicitly like jflect::read/write.
+ */
+template<class T>
+struct codec {
+  static std::string write(const T& value);
+  static buffer_result write_to_buffer(std::span<char> buffer, const T& value);
+  static const char* read_to(std::string_view sv, T& value);
+  static T read(std::string_view sv);
+};
+
+} // namespace jflect
+
+// suppresses the instantiation of jflect::codec<T> in the translation units which see it, put it next to T
+#define JFLECT_DECLARE_CODEC(...) extern template struct ::jflect::codec<__VA_ARGS__>;
+
+// instantiates jflect::codec<T>, in exactly one translation unit which includes jflect.hpp
+#define JFLECT_DEFINE_CODEC(...) template struct ::jflect::codec<__VA_ARGS__>;
+
+#endif // JFLECT_CODEC_HPP_
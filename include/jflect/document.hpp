@@ -0,0 +1,195 @@
+#ifndef JFLECT_DOCUMENT_HPP_
+#define JFLECT_DOCUMENT_HPP_
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "jflect.hpp"
+#include "parser.hpp"
+
+namespace jflect {
+
+/**
+ * @brief a view of a json-value which is only parsed when it is accessed
+ *
+ * Accessing a member or an element skips over everything in front of it with parser::skip_value without
+ * materializing or validating it.
+ * The viewed input has to outlive the lazy_value.
+ */
+class lazy_value {
+public:
+  constexpr lazy_value() noexcept = default;
+
+  /**
+   * @param sv a view from the begining of a json-value to its end (or beyond)
+   */
+  constexpr explicit lazy_value(std::string_view sv) noexcept : m_sv(sv) { parser::trim(m_sv); }
+
+  [[nodiscard]] constexpr parser::value_type type() const noexcept { return parser::peek_type(m_sv); }
+
+  [[nodiscard]] constexpr bool is_null() const noexcept { return type() == parser::value_type::null; }
+
+  /**
+   * @brief the unparsed json text of this value
+   */
+  [[nodiscard]] constexpr std::string_view raw() const {
+    const auto rest = parser::skip_value(m_sv);
+    return m_sv.substr(0, std::size(m_sv) - std::size(rest));
+  }
+
+  /**
+   * @brief looks up a member of an object
+   *
+   * @return the member or std::nullopt if the object has no member with the given key
+   */
+  [[nodiscard]] constexpr std::optional<lazy_value> find(std::string_view key) const {
+    auto sv = m_sv;
+
+    parser::trim_read_trim(sv, '{');
+
+    if (sv.starts_with('}')) // empty object
+      return std::nullopt;
+
+    for (;;) {
+      const auto afterKey = parser::skip_string(sv);
+      const auto member = sv.substr(1, std::size(sv) - std::size(afterKey) - 2);
+
+      sv = afterKey;
+      parser::trim_read(sv, ':');
+
+      if (key_equals(member, key))
+        return lazy_value(sv);
+
+      sv = parser::skip_value(sv);
+
+      parser::trim(sv);
+      if (!parser::optional_read(sv, ','))
+        break;
+      parser::trim(sv);
+    }
+
+    parser::trim_read(sv, '}');
+    return std::nullopt;
+  }
+
+  /**
+   * @brief looks up an element of an array
+   *
+   * @return the element or std::nullopt if the index is out of range
+   */
+  [[nodiscard]] constexpr std::optional<lazy_value> at(std::size_t index) const {
+    auto sv = m_sv;
+
+    parser::trim_read_trim(sv, '[');
+
+    if (sv.starts_with(']')) // empty array
+      return std::nullopt;
+
+    for (std::size_t i = 0;; ++i) {
+      if (i == index)
+        return lazy_value(sv);
+
+      sv = parser::skip_value(sv);
+
+      parser::trim(sv);
+      if (!parser::optional_read(sv, ','))
+        break;
+    }
+
+    parser::trim_read(sv, ']');
+    return std::nullopt;
+  }
+
+  [[nodiscard]] constexpr lazy_value operator[](std::string_view key) const {
+    const auto result = find(key);
+    assert(result.has_value() && "object has no such member");
+    return result.value_or(lazy_value());
+  }
+
+  [[nodiscard]] constexpr lazy_value operator[](std::size_t index) const {
+    const auto result = at(index);
+    assert(result.has_value() && "array index out of range");
+    return result.value_or(lazy_value());
+  }
+
+  /**
+   * @brief counts the elements of an array or the members of an object
+   */
+  [[nodiscard]] constexpr std::size_t size() const {
+    auto sv = m_sv;
+    const auto isObject = type() == parser::value_type::object;
+
+    parser::trim_read_trim(sv, isObject ? '{' : '[');
+
+    if (parser::optional_read(sv, isObject ? '}' : ']'))
+      return 0;
+
+    std::size_t count = 0;
+    for (;;) {
+      if (isObject) {
+        sv = parser::skip_string(sv);
+        parser::trim_read(sv, ':');
+      }
+      sv = parser::skip_value(sv);
+      ++count;
+
+      parser::trim(sv);
+      if (!parser::optional_read(sv, ','))
+        break;
+    }
+
+    return count;
+  }
+
+  template<class T>
+  auto get_to(T& value) const -> decltype(std::begin(std::string_view())) {
+    assert(!m_sv.empty() && "value is missing");
+    return read_to(m_sv, value);
+  }
+
+  template<class T>
+    requires(std::is_default_constructible_v<T>)
+  [[nodiscard]] T get() const {
+    T result;
+    get_to(result);
+    return result;
+  }
+
+private:
+  // a member name with escape sequences is decoded before it is compared, so "a\u0062" matches ab
+  static constexpr bool key_equals(std::string_view member, std::string_view key) {
+    if (parser::detail::find_string_special(member) == std::size(member)) {
+      return member == key;
+    }
+    std::string unescaped;
+    parser::parse_string_append(std::string_view(std::data(member), std::size(member) + 1), unescaped); // with the "
+    return unescaped == key;
+  }
+
+  std::string_view m_sv;
+};
+
+/**
+ * @brief a json document which is only parsed as far as it is accessed
+ *
+ * doc["a"]["b"][3].get<int>() only reads the integer and skips everything in front of it.
+ */
+class document {
+public:
+  constexpr explicit document(std::string_view input) noexcept : m_input(input) {}
+
+  [[nodiscard]] constexpr lazy_value root() const noexcept { return lazy_value(m_input); }
+
+  [[nodiscard]] constexpr lazy_value operator[](std::string_view key) const { return root()[key]; }
+  [[nodiscard]] constexpr lazy_value operator[](std::size_t index) const { return root()[index]; }
+
+  [[nodiscard]] constexpr std::string_view input() const noexcept { return m_input; }
+
+private:
+  std::string_view m_input;
+};
+
+} // namespace jflect
+#endif // JFLECT_DOCUMENT_HPP_
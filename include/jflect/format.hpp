@@ -0,0 +1,172 @@
+#ifndef JFLECT_FORMAT_HPP_
+#define JFLECT_FORMAT_HPP_
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#include "helper.hpp"
+#include "parser.hpp"
+#include "simd.hpp"
+
+/**
+ * Reformatting of json text without any type information, e.g. to compact pretty-printed json which is forwarded.
+ *
+ * const auto compact = jflect::minify(R"({ "a": [1, 2], "b": "x y" })"); // {"a":[1,2],"b":"x y"}
+ * const auto pretty = jflect::reformat(compact, 2);
+ *
+ * The input has to be well-formed json, see validate.hpp for untrusted input. Runs without whitespace and strings are
+ * found a simd::block at a time and copied at once.
+ */
+namespace jflect {
+
+namespace format_helper {
+
+// the position past the closing " of a json-string which starts at pos
+constexpr std::size_t string_end(std::string_view sv, std::size_t pos) noexcept {
+  assert(sv[pos] == '"');
+  ++pos;
+
+  while (pos < std::size(sv)) {
+    const auto first = std::data(sv) + pos;
+    const auto match = simd::find_if(
+        first,
+        std::data(sv) + std::size(sv),
+        [](const simd::block& b) { return b.any_of('"', '\\'); },
+        [](char c) { return c == '"' || c == '\\'; });
+    pos += static_cast<std::size_t>(match - first);
+
+    if (pos < std::size(sv) && sv[pos] == '"') {
+      return pos + 1;
+    }
+    pos += 2; // an escape sequence, its second character may be a "
+  }
+
+  assert(false && "unterminated json-string");
+  return std::size(sv);
+}
+
+// the position of the first whitespace or json-string at or after pos
+constexpr std::size_t find_space_or_string(std::string_view sv, std::size_t pos) noexcept {
+  const auto first = std::data(sv) + pos;
+  const auto match = simd::find_if(
+      first,
+      std::data(sv) + std::size(sv),
+      [](const simd::block& b) { return b.any_of(' ', '\n', '\r', '\t', '"'); },
+      [](char c) { return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == '"'; });
+  return pos + static_cast<std::size_t>(match - first);
+}
+
+// the position past a number or literal which starts at pos
+constexpr std::size_t scalar_end(std::string_view sv, std::size_t pos) noexcept {
+  const auto end = sv.find_first_of(" \n\r\t,:]}", pos);
+  return end == std::string_view::npos ? std::size(sv) : end;
+}
+
+constexpr void newline(std::output_iterator<const char&> auto out, std::size_t width) {
+  constexpr std::string_view spaces = "                                ";
+
+  out = '\n';
+  for (; width > std::size(spaces); width -= std::size(spaces)) {
+    detail::write_chars(out, spaces);
+  }
+  detail::write_chars(out, spaces.substr(0, width));
+}
+
+} // namespace format_helper
+
+/**
+ * @brief writes sv without the whitespace between tokens, json-strings are copied as they are
+ */
+constexpr void minify_to(std::output_iterator<const char&> auto out, std::string_view sv) {
+  std::size_t pos = 0;
+
+  while (pos < std::size(sv)) {
+    const auto next = format_helper::find_space_or_string(sv, pos);
+    detail::write_chars(out, sv.substr(pos, next - pos));
+    if (next == std::size(sv)) {
+      break;
+    }
+
+    if (sv[next] == '"') {
+      pos = format_helper::string_end(sv, next);
+      detail::write_chars(out, sv.substr(next, pos - next));
+    } else {
+      pos = parser::detail::skip_whitespace(sv, next);
+    }
+  }
+}
+
+inline std::string minify(std::string_view sv) {
+  std::string str;
+  str.reserve(std::size(sv));
+  minify_to(detail::string_appender(str), sv);
+  return str;
+}
+
+/**
+ * @brief writes sv with one member or element per line, indented by indent spaces per level
+ *
+ * Empty arrays and objects stay on one line, a space follows every colon.
+ */
+constexpr void reformat_to(std::output_iterator<const char&> auto out, std::string_view sv, std::size_t indent = 2) {
+  std::size_t depth = 0;
+  auto pos = parser::detail::skip_whitespace(sv, 0);
+
+  while (pos < std::size(sv)) {
+    switch (sv[pos]) {
+      case '"': {
+        const auto end = format_helper::string_end(sv, pos);
+        detail::write_chars(out, sv.substr(pos, end - pos));
+        pos = end;
+        break;
+      }
+      case '{':
+      case '[': {
+        const auto close = sv[pos] == '{' ? '}' : ']';
+        out = sv[pos];
+        pos = parser::detail::skip_whitespace(sv, pos + 1);
+        if (pos < std::size(sv) && sv[pos] == close) {
+          out = close;
+          ++pos;
+        } else {
+          format_helper::newline(out, ++depth * indent);
+        }
+        break;
+      }
+      case '}':
+      case ']':
+        assert(depth > 0);
+        format_helper::newline(out, --depth * indent);
+        out = sv[pos++];
+        break;
+      case ',':
+        out = ',';
+        format_helper::newline(out, depth * indent);
+        ++pos;
+        break;
+      case ':':
+        detail::write_chars(out, ": ");
+        ++pos;
+        break;
+      default: {
+        const auto end = format_helper::scalar_end(sv, pos);
+        detail::write_chars(out, sv.substr(pos, end - pos));
+        pos = end;
+        break;
+      }
+    }
+    pos = parser::detail::skip_whitespace(sv, pos);
+  }
+}
+
+inline std::string reformat(std::string_view sv, std::size_t indent = 2) {
+  std::string str;
+  reformat_to(detail::string_appender(str), sv, indent);
+  return str;
+}
+
+} // namespace jflect
+#endif // JFLECT_FORMAT_HPP_
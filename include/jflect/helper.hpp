@@ -1,5 +1,9 @@
 #ifndef JFLECT_HELPER_HPP_
 #define JFLECT_HELPER_HPP_
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
 #include <string_view>
 
 #include "concepts.hpp"
@@ -35,5 +39,53 @@ template<std::ranges::range R>
 
   return true;
 }
+
+// a string literal which can be used as a non-type template parameter
+template<std::size_t N>
+struct fixed_string {
+  char data[N]{};
+
+  consteval fixed_string(const char (&str)[N]) noexcept { std::copy_n(str, N, data); }
+
+  [[nodiscard]] constexpr std::string_view view() const noexcept { return {data, N - 1}; }
+  [[nodiscard]] static constexpr std::size_t size() noexcept { return N - 1; }
+};
+
+/**
+ * @brief an output iterator which appends to a std::string, runs of characters are appended at once
+ */
+class string_appender {
+public:
+  using iterator_category = std::output_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = void;
+  using pointer = void;
+  using reference = void;
+
+  constexpr explicit string_appender(std::string& str) noexcept : m_str(&str) {}
+
+  constexpr string_appender& operator=(char c) {
+    m_str->push_back(c);
+    return *this;
+  }
+
+  constexpr void append(std::string_view sv) { m_str->append(sv); }
+
+  constexpr string_appender& operator*() noexcept { return *this; }
+  constexpr string_appender& operator++() noexcept { return *this; }
+  constexpr string_appender& operator++(int) noexcept { return *this; }
+
+private:
+  std::string* m_str;
+};
+
+// writes a run of characters, at once if the output iterator supports it
+constexpr void write_chars(std::output_iterator<const char&> auto out, std::string_view sv) {
+  if constexpr (requires { out.append(sv); }) { // string_appender and the bounded_iterator of write_to_buffer
+    out.append(sv);
+  } else {
+    std::copy(std::begin(sv), std::end(sv), out); // [INFO] c++20 ranges
+  }
+}
 } // namespace jflect::detail
 #endif // JFLECT_HELPER_HPP_
@@ -0,0 +1,178 @@
+#ifndef JFLECT_INTERN_HPP_
+#define JFLECT_INTERN_HPP_
+#include <algorithm>
+#include <cassert>
+#include <compare>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "parser.hpp"
+
+/**
+ * String interning for reads which repeat the same strings (map keys, enum-like fields). A jflect::interned_string
+ * views the one copy of its characters in an intern_pool, so a string which has been seen before is not allocated
+ * again.
+ *
+ * jflect::intern_pool pool;
+ * jflect::intern_scope scope(pool); // the pool which is used by the reads on this thread
+ * auto cache = jflect::read<std::map<jflect::interned_string, Entry>>(json);
+ *
+ * The interned strings stay valid as long as the pool.
+ */
+namespace jflect {
+
+class intern_pool;
+
+namespace detail {
+
+// the pool of the innermost intern_scope on this thread
+inline thread_local intern_pool* current_pool = nullptr;
+
+} // namespace detail
+
+/**
+ * @brief a view of characters which are owned by an intern_pool, compared by its characters
+ */
+class interned_string {
+public:
+  using value_type = char;
+  using const_iterator = const char*;
+  using iterator = const_iterator;
+
+  constexpr interned_string() noexcept = default;
+
+  constexpr operator std::string_view() const noexcept { return m_view; }
+
+  [[nodiscard]] constexpr std::string_view view() const noexcept { return m_view; }
+
+  [[nodiscard]] constexpr const char* data() const noexcept { return std::data(m_view); }
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return std::size(m_view); }
+  [[nodiscard]] constexpr bool empty() const noexcept { return m_view.empty(); }
+  [[nodiscard]] constexpr const char* begin() const noexcept { return data(); }
+  [[nodiscard]] constexpr const char* end() const noexcept { return data() + size(); }
+
+  friend constexpr bool operator==(interned_string a, interned_string b) noexcept {
+    const auto same = std::data(a.m_view) == std::data(b.m_view); // the same entry of a pool
+    return same ? std::size(a.m_view) == std::size(b.m_view) : a.m_view == b.m_view;
+  }
+
+  friend constexpr std::strong_ordering operator<=>(interned_string a, interned_string b) noexcept {
+    return a.m_view <=> b.m_view;
+  }
+
+private:
+  friend class intern_pool;
+
+  constexpr explicit interned_string(std::string_view sv) noexcept : m_view(sv) {}
+
+  std::string_view m_view;
+};
+
+/**
+ * @brief owns one copy of every distinct string which is interned
+ *
+ * The characters are stored in blocks which are never moved. A pool is not synchronized, use one per thread or
+ * synchronize the reads.
+ */
+class intern_pool {
+public:
+  intern_pool() = default;
+  intern_pool(const intern_pool&) = delete;
+  intern_pool& operator=(const intern_pool&) = delete;
+
+  interned_string intern(std::string_view sv) {
+    if (const auto search = m_strings.find(sv); search != std::end(m_strings)) {
+      return interned_string(*search);
+    }
+    const auto stored = store(sv);
+    m_strings.insert(stored);
+    return interned_string(stored);
+  }
+
+  // the number of distinct strings
+  [[nodiscard]] std::size_t size() const noexcept { return std::size(m_strings); }
+
+  // the bytes of all blocks
+  [[nodiscard]] std::size_t capacity() const noexcept { return m_capacity; }
+
+  // reused to unescape a string before its lookup
+  std::string& buffer() noexcept { return m_buffer; }
+
+private:
+  static constexpr std::size_t blockSize = 64 * 1024;
+
+  std::string_view store(std::string_view sv) {
+    if (static_cast<std::size_t>(m_end - m_pos) < std::size(sv)) {
+      const auto size = std::max(blockSize, std::size(sv)); // a long string gets a block of its own
+      m_blocks.push_back(std::make_unique<char[]>(size));
+      m_pos = m_blocks.back().get();
+      m_end = m_pos + size;
+      m_capacity += size;
+    }
+    const auto* begin = m_pos;
+    m_pos = std::copy(std::begin(sv), std::end(sv), m_pos);
+    return {begin, std::size(sv)};
+  }
+
+  std::unordered_set<std::string_view> m_strings;
+  std::vector<std::unique_ptr<char[]>> m_blocks;
+  char* m_pos = nullptr;
+  char* m_end = nullptr;
+  std::size_t m_capacity = 0;
+  std::string m_buffer;
+};
+
+/**
+ * @brief selects the pool of the interned_string reads on this thread until the end of its scope
+ */
+class intern_scope {
+public:
+  explicit intern_scope(intern_pool& pool) noexcept : m_previous(std::exchange(detail::current_pool, &pool)) {}
+
+  intern_scope(const intern_scope&) = delete;
+  intern_scope& operator=(const intern_scope&) = delete;
+
+  ~intern_scope() { detail::current_pool = m_previous; }
+
+private:
+  intern_pool* m_previous;
+};
+
+// a string without escape sequences is looked up as it is in the input, others are unescaped into the pool's buffer
+inline auto read_to(std::string_view sv, interned_string& value) -> decltype(std::begin(sv)) {
+  auto* pool = detail::current_pool;
+  assert(pool != nullptr && "an interned_string is read without an intern_scope");
+
+  parser::trim_read(sv, '"');
+
+  const auto run = sv.substr(0, parser::detail::find_string_special(sv));
+  if (std::size(run) < std::size(sv) && sv[std::size(run)] == '"') {
+    parser::detail::check_run(run);
+    value = pool->intern(run);
+    return std::begin(sv) + std::size(run) + 1;
+  }
+
+  auto& buffer = pool->buffer();
+  buffer.clear();
+  const auto rest = parser::parse_string_append(sv, buffer);
+  value = pool->intern(buffer);
+  return std::begin(rest);
+}
+
+} // namespace jflect
+
+template<>
+struct std::hash<jflect::interned_string> {
+  std::size_t operator()(jflect::interned_string value) const noexcept {
+    return std::hash<std::string_view>{}(value.view());
+  }
+};
+
+#endif // JFLECT_INTERN_HPP_
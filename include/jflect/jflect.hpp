@@ -1,20 +1,32 @@
 #ifndef JFLECT_JFLECT_HPP_
 #define JFLECT_JFLECT_HPP_
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <charconv>
 #include <concepts>
+#include <cstdint>
+#include <cstdio>
 #include <iterator>
+#include <limits>
 #include <ranges>
 #include <string>
 #include <string_view>
 #include <optional>
 #include <functional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
+#include "codec.hpp"
 #include "concepts.hpp"
 #include "helper.hpp"
 #include "meta.hpp"
+#include "options.hpp"
 #include "parser.hpp"
+#include "simd.hpp"
+#include "trace.hpp"
 #include "traits.hpp"
 
 #include "fast_float/fast_float.h"
@@ -23,11 +35,64 @@
 
 namespace jflect {
 
+/*------------------------------ bounded output ------------------------------*/
+
+namespace detail {
+
+// the memory of write_to_buffer, the characters which do not fit are only counted
+struct bounded_buffer {
+  char* pos;
+  char* end;
+  std::size_t overflow = 0;
+};
+
+/**
+ * @brief an output iterator which stores into a bounded_buffer
+ *
+ * The copies of an iterator share the buffer, because write_to passes the iterator on by value.
+ */
+class bounded_iterator {
+public:
+  using iterator_category = std::output_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = void;
+  using pointer = void;
+  using reference = void;
+
+  constexpr explicit bounded_iterator(bounded_buffer& buffer) noexcept : m_buffer(&buffer) {}
+
+  constexpr bounded_iterator& operator=(char c) noexcept {
+    if (m_buffer->pos != m_buffer->end) {
+      *m_buffer->pos++ = c;
+    } else {
+      ++m_buffer->overflow;
+    }
+    return *this;
+  }
+
+  // stores a run of characters at once
+  constexpr void append(std::string_view sv) noexcept {
+    const auto count = std::min(std::size(sv), static_cast<std::size_t>(m_buffer->end - m_buffer->pos));
+    m_buffer->pos = std::copy_n(std::data(sv), count, m_buffer->pos);
+    m_buffer->overflow += std::size(sv) - count;
+  }
+
+  constexpr bounded_iterator& operator*() noexcept { return *this; }
+  constexpr bounded_iterator& operator++() noexcept { return *this; }
+  constexpr bounded_iterator& operator++(int) noexcept { return *this; }
+
+private:
+  bounded_buffer* m_buffer;
+};
+
+} // namespace detail
+
+/*----------------------------------------------------------------------------*/
+
 template<class T>
   requires(std::is_same_v<T, bool>)
 constexpr void write_to(std::output_iterator<const char&> auto out, T value) {
-  const auto sv = std::string_view(value ? "true" : "false");
-  std::copy(std::begin(sv), std::end(sv), out); // [INFO] c++20 ranges
+  detail::write_chars(out, value ? "true" : "false");
 }
 
 template<class T>
@@ -47,20 +112,170 @@ constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)
   }
 }
 
+namespace number_helper {
+
+// the maximal number of characters of a formatted number: sign and digits (and '.' and 6 decimals for %f)
+template<class T>
+inline constexpr std::size_t max_size_v = std::is_floating_point_v<T> ? std::numeric_limits<T>::max_exponent10 + 10
+                                                                      : std::numeric_limits<T>::digits10 + 3;
+
+/**
+ * @brief formats value into [first, first + max_size_v<T>)
+ *
+ * Integers are formatted with std::to_chars, floating points like std::to_string ("%f"), with std::to_chars if the
+ * standard library implements it for floating points.
+ *
+ * @return the end of the formatted number
+ */
+template<class T>
+char* format(char* first, T value) noexcept {
+  if constexpr (std::is_floating_point_v<T>) {
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+    const auto [ptr, ec] = std::to_chars(first, first + max_size_v<T>, value, std::chars_format::fixed, 6);
+    assert(ec == std::errc());
+    return ptr;
+#else
+    int size = 0;
+    if constexpr (std::is_same_v<T, long double>) {
+      size = std::snprintf(first, max_size_v<T>, "%Lf", value);
+    } else {
+      size = std::snprintf(first, max_size_v<T>, "%f", static_cast<double>(value));
+    }
+    assert(0 <= size && static_cast<std::size_t>(size) < max_size_v<T>);
+    return first + size;
+#endif
+  } else {
+    const auto [ptr, ec] = std::to_chars(first, first + max_size_v<T>, value);
+    assert(ec == std::errc());
+    return ptr;
+  }
+}
+
+} // namespace number_helper
+
 template<std::integral T>
   requires(!std::same_as<T, bool>)
 /*[TODO] constexpr to_chars*/ void write_to(std::output_iterator<const char&> auto out, T value) {
-  std::array<char, std::numeric_limits<decltype(value)>::digits10 + 1> str;
-  const auto [ptr, ec] = std::to_chars(std::begin(str), std::end(str), value);
-  assert(ec != std::errc::value_too_large);
-  std::copy(std::data(str), ptr, out);
+  std::array<char, number_helper::max_size_v<T>> str;
+  detail::write_chars(out, std::string_view(std::data(str), number_helper::format(std::data(str), value)));
 }
 
+namespace number_helper {
+
+// std::from_chars is not constexpr before c++23, this is only used during constant evaluation
+template<std::integral T>
+constexpr auto parse_integral(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  using accumulator = std::conditional_t<std::is_signed_v<T>, std::int64_t, std::uint64_t>;
+
+  auto iter = std::begin(sv);
+  const bool negative = iter != std::end(sv) && *iter == '-';
+  if (negative) {
+    assert(std::is_signed_v<T> && "negative value for an unsigned type");
+    ++iter;
+  }
+
+  assert(iter != std::end(sv) && '0' <= *iter && *iter <= '9' && "not a number");
+
+  accumulator result = 0;
+  for (; iter != std::end(sv) && '0' <= *iter && *iter <= '9'; ++iter) {
+    const auto digit = static_cast<accumulator>(*iter - '0');
+    // checked before the step, the accumulator would otherwise wrap for 20 and more digits
+    if (negative) {
+      assert(result >= (std::numeric_limits<accumulator>::min() + digit) / 10 && "value out of range");
+      result = result * 10 - digit;
+    } else {
+      assert(result <= (std::numeric_limits<accumulator>::max() - digit) / 10 && "value out of range");
+      result = result * 10 + digit;
+    }
+  }
+
+  assert(std::in_range<T>(result) && "value out of range");
+  value = static_cast<T>(result);
+  return iter;
+}
+
+/**
+ * @brief the constant evaluation counterpart of fast_float::from_chars
+ *
+ * The result is correctly rounded for up to 15 significant digits and decimal exponents within [-22, 22], which is
+ * what hand written configuration values look like. Other values may be off by a few ulp.
+ */
+template<std::floating_point T>
+constexpr auto parse_floating(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  constexpr double pow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                              1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+  constexpr int maxExactExponent = 22;
+
+  auto iter = std::begin(sv);
+  const auto isDigit = [&iter, &sv] { return iter != std::end(sv) && '0' <= *iter && *iter <= '9'; };
+
+  const bool negative = iter != std::end(sv) && *iter == '-';
+  if (negative) {
+    ++iter;
+  }
+
+  assert(isDigit() && "not a number");
+
+  std::uint64_t mantissa = 0;
+  int exponent = 0;
+
+  // digits which do not fit into the mantissa only shift the exponent
+  const auto appendDigit = [&](bool isFraction) {
+    if (mantissa < 1'000'000'000'000'000'000u) {
+      mantissa = mantissa * 10 + static_cast<std::uint64_t>(*iter - '0');
+      if (isFraction) {
+        --exponent;
+      }
+    } else if (!isFraction) {
+      ++exponent;
+    }
+  };
+
+  for (; isDigit(); ++iter) {
+    appendDigit(false);
+  }
+
+  if (iter != std::end(sv) && *iter == '.') {
+    ++iter;
+    for (; isDigit(); ++iter) {
+      appendDigit(true);
+    }
+  }
+
+  if (iter != std::end(sv) && (*iter == 'e' || *iter == 'E')) {
+    ++iter;
+    if (iter != std::end(sv) && *iter == '+') {
+      ++iter;
+    }
+    int explicitExponent = 0;
+    iter = parse_integral(std::string_view(iter, std::end(sv)), explicitExponent);
+    exponent += explicitExponent;
+  }
+
+  auto result = static_cast<double>(mantissa);
+  for (; exponent > maxExactExponent; exponent -= maxExactExponent) {
+    result *= pow10[maxExactExponent];
+  }
+  for (; exponent < -maxExactExponent; exponent += maxExactExponent) {
+    result /= pow10[maxExactExponent];
+  }
+  result = exponent >= 0 ? result * pow10[exponent] : result / pow10[-exponent];
+
+  value = static_cast<T>(negative ? -result : result);
+  return iter;
+}
+
+} // namespace number_helper
+
 template<std::integral T>
   requires(!std::same_as<T, bool>)
-/*[TODO] constexpr from_chars*/ auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
   parser::trim(sv);
 
+  if (std::is_constant_evaluated()) {
+    return number_helper::parse_integral(sv, value);
+  }
+
   const auto [ptr, ec] = std::from_chars(std::data(sv), std::data(sv) + std::size(sv), value);
   assert(ec == std::errc());
   return ptr;
@@ -68,22 +283,19 @@ template<std::integral T>
 
 template<std::floating_point T>
 /*[TODO] constexpr to_chars*/ void write_to(std::output_iterator<const char&> auto out, T value) {
-#if __has_cpp_attribute(__cpp_lib_to_chars)
-  std::array<char, std::numeric_limits<T>::max_digits10 + 1> str;
-  const auto [ptr, ec] = std::to_chars(std::begin(str), std::end(str), value);
-  assert(ec == std::errc());
-  buffer.append(std::data(str), ptr)
-#else
-  const auto output = std::to_string(value);
-  std::copy(std::begin(output), std::end(output), out); // [INFO] c++20 ranges
-#endif
+  std::array<char, number_helper::max_size_v<T>> str;
+  detail::write_chars(out, std::string_view(std::data(str), number_helper::format(std::data(str), value)));
 }
 
 template<std::floating_point T>
-/*[TODO] constexpr from_chars*/ auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
   parser::trim(sv);
 
-#if __has_cpp_attribute(__cpp_lib_to_chars)
+  if (std::is_constant_evaluated()) {
+    return number_helper::parse_floating(sv, value);
+  }
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
   const auto [ptr, ec] = std::from_chars(std::data(sv), std::data(sv) + std::size(sv), value);
 #else
   const auto [ptr, ec] = fast_float::from_chars(std::data(sv), std::data(sv) + std::size(sv), value);
@@ -95,14 +307,28 @@ template<std::floating_point T>
 
 template<cpt::enumeration T>
 constexpr void write_to(std::output_iterator<const char&> auto out, T value) {
-  const auto output = meta::enumerator_helper<T>::toString(value);
-  out = '\"';
-  std::copy(std::begin(output), std::end(output), out); // [INFO] c++20 ranges
-  out = '\"';
+  if constexpr (detail::encodes_enum_integer_v<T>) {
+    write_to(out, static_cast<std::underlying_type_t<T>>(value));
+  } else {
+    const auto output = meta::enumerator_helper<T>::toString(value);
+    out = '\"';
+    detail::write_chars(out, output);
+    out = '\"';
+  }
 }
 
 template<cpt::enumeration T>
 constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  if constexpr (detail::encodes_enum_integer_v<T>) {
+    parser::trim(sv);
+    if (!detail::encodes_enum_name_v<T> || !sv.starts_with('"')) {
+      std::underlying_type_t<T> underlying{};
+      const auto iter = read_to(sv, underlying);
+      value = static_cast<T>(underlying);
+      return iter;
+    }
+  }
+
   parser::trim_read(sv, '"');
 
   const auto end = std::find_if_not(std::begin(sv), std::end(sv), [](auto c) {
@@ -122,20 +348,80 @@ constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)
   return std::next(end);
 }
 
+namespace string_helper {
+
+// '"', '\\' and the control characters have to be escaped inside a json-string
+constexpr bool needs_escape(char c) noexcept {
+  return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20u;
+}
+
+constexpr void write_escape(std::output_iterator<const char&> auto out, char c) {
+  out = '\\';
+  switch (c) {
+    // clang-format off
+    case '"':  out = '"';  break;
+    case '\\': out = '\\'; break;
+    case '\b': out = 'b';  break;
+    case '\f': out = 'f';  break;
+    case '\n': out = 'n';  break;
+    case '\r': out = 'r';  break;
+    case '\t': out = 't';  break;
+    // clang-format on
+    default: {
+      constexpr auto hex = std::string_view("0123456789abcdef");
+      const auto byte = static_cast<unsigned char>(c);
+      out = 'u';
+      out = '0';
+      out = '0';
+      out = hex[byte >> 4u];
+      out = hex[byte & 0xFu];
+    }
+  }
+}
+
+/**
+ * @brief writes str with escape sequences, the runs in between are found a simd::block at a time and copied at once
+ */
+constexpr void write_escaped(std::output_iterator<const char&> auto out, std::string_view str) {
+  const auto blockMask = [](const simd::block& b) { return b.any_of('"', '\\') | b.lt(0x20u); };
+
+  auto first = std::data(str);
+  const auto last = first + std::size(str);
+
+  while (true) {
+    const auto escape = simd::find_if(first, last, blockMask, needs_escape);
+    detail::write_chars(out, std::string_view(first, static_cast<std::size_t>(escape - first)));
+    if (escape == last) {
+      return;
+    }
+    write_escape(out, *escape);
+    first = std::next(escape);
+  }
+}
+
+} // namespace string_helper
+
 template<cpt::string_like T>
 constexpr void write_to(std::output_iterator<const char&> auto out, const T& value) {
   out = '\"';
-  std::copy(std::begin(value), std::end(value), out);
+  string_helper::write_escaped(out, std::string_view(std::data(value), std::size(value)));
   out = '\"';
 }
 
-// [INFO] T HAS TO BE OWNING
+// [INFO] T HAS TO BE OWNING, a std::string_view views the input and can not contain escape sequences
 template<cpt::string_like T>
-/* [TODO] constexpr*/ auto read_to(std::string_view sv, T& value)
+constexpr auto read_to(std::string_view sv, T& value)
     -> decltype(std::begin(sv)) requires(std::constructible_from<T, const char*, const char*>) {
-  static_assert(!std::same_as<std::remove_cvref<T>, std::string_view> && "std::string_view is non owning!");
   static_assert(!detail::is_span_v<std::remove_cvref<T>> && "std::span is non owning!");
 
+  if constexpr (std::same_as<T, std::string_view>) {
+    parser::trim(sv);
+    const auto rest = parser::skip_string(sv);
+    value = sv.substr(1, std::size(sv) - std::size(rest) - 2);
+    assert(value.find('\\') == std::string_view::npos && "an escaped string can not be viewed");
+    return std::begin(rest);
+  }
+
   parser::trim_read(sv, '"');
 
   const auto [str, newsv] = parser::parse_string(sv);
@@ -160,6 +446,26 @@ template<std::size_t N>
 constexpr auto read_to(std::string_view sv, const char value[N]) = delete;
 
 /*--------------------------- Forward Declarations ---------------------------*/
+class value;
+class value_ref;
+
+template<detail::fixed_string Key, class... Tags>
+class tagged_union;
+
+namespace detail {
+template<class T>
+inline constexpr bool is_dynamic_value_v = std::same_as<T, value> || std::same_as<T, value_ref>;
+
+template<class T>
+struct is_tagged_union : std::false_type {};
+
+template<fixed_string Key, class... Tags>
+struct is_tagged_union<tagged_union<Key, Tags...>> : std::true_type {};
+
+template<class T>
+inline constexpr bool is_tagged_union_v = is_tagged_union<T>::value;
+} // namespace detail
+
 template<cpt::range_like T>
 constexpr void write_to(std::output_iterator<const char&> auto out, T&& value);
 
@@ -175,16 +481,22 @@ template<cpt::map_like T>
 constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv));
 
 template<cpt::public_struct T>
-  requires(!std::ranges::range<T> &&                                              // no ranges
-           !cpt::tuple_like<T> &&                                                 // no tuple
-           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional> // no optional
+  requires(!std::ranges::range<T> &&                                                // no ranges
+           !cpt::tuple_like<T> &&                                                   // no tuple
+           !detail::is_dynamic_value_v<std::remove_cvref_t<T>> &&                   // no jflect::value
+           !detail::is_tagged_union_v<std::remove_cvref_t<T>> &&                    // no tagged_union
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::variant> && // no variant
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional>   // no optional
   )
 constexpr void write_to(std::output_iterator<const char&> auto out, T&& value);
 
 template<cpt::public_struct T>
-  requires(!std::ranges::range<T> &&                                              // no ranges
-           !cpt::tuple_like<T> &&                                                 // no tuple
-           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional> // no optional
+  requires(!std::ranges::range<T> &&                                                // no ranges
+           !cpt::tuple_like<T> &&                                                   // no tuple
+           !detail::is_dynamic_value_v<std::remove_cvref_t<T>> &&                   // no jflect::value
+           !detail::is_tagged_union_v<std::remove_cvref_t<T>> &&                    // no tagged_union
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::variant> && // no variant
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional>   // no optional
   )
 constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv));
 
@@ -200,6 +512,12 @@ constexpr void write_to(std::output_iterator<const char&> auto out, const std::o
 template<class T>
 constexpr auto read_to(std::string_view sv, std::optional<T>& value) -> decltype(std::begin(sv));
 
+template<class... Ts>
+constexpr void write_to(std::output_iterator<const char&> auto out, const std::variant<Ts...>& value);
+
+template<class... Ts>
+constexpr auto read_to(std::string_view sv, std::variant<Ts...>& value) -> decltype(std::begin(sv));
+
 /*----------------------------------------------------------------------------*/
 
 namespace detail {
@@ -269,7 +587,7 @@ struct read_map_iterator {
 
     parser::trim_read(m_sv.get(), ':');
 
-    mapped_type mapped;
+    mapped_type mapped{};
 
     m_sv.get() = std::string_view(read_to(m_sv.get(), mapped), std::end(m_sv.get()));
 
@@ -294,8 +612,160 @@ struct read_map_iterator {
 };
 } // namespace detail
 
+namespace array_helper {
+
+template<class T>
+inline constexpr bool is_number_v = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+// a number or a (nested) std::array of numbers, like a vector or a matrix
+template<class T>
+struct is_numeric_block : std::bool_constant<is_number_v<T>> {};
+
+template<class T, std::size_t N>
+struct is_numeric_block<std::array<T, N>> : is_numeric_block<T> {};
+
+template<class T>
+inline constexpr bool is_numeric_block_v = is_numeric_block<std::remove_cvref_t<T>>::value;
+
+// a range of numeric blocks which is read by appending to its end
+template<class T>
+inline constexpr bool is_numeric_sequence_v =
+    std::ranges::contiguous_range<T> && is_numeric_block_v<std::ranges::range_value_t<T>> && requires(T& t) {
+      t.clear();
+      t.emplace_back();
+    };
+
+constexpr const char* skip_whitespace(const char* first, const char* last) noexcept {
+  while (first != last && (*first == ' ' || *first == '\n' || *first == '\r' || *first == '\t')) {
+    ++first;
+  }
+  return first;
+}
+
+constexpr const char* read_char(const char* first, const char* last, [[maybe_unused]] char c) noexcept {
+  first = skip_whitespace(first, last);
+  assert(first != last && *first == c);
+  return first != last ? std::next(first) : first;
+}
+
+/**
+ * @brief reads a numeric block in place, without the separator search of read_range_iterator
+ */
+template<class T>
+constexpr const char* read_block(const char* first, const char* last, T& value) {
+  if constexpr (is_number_v<T>) {
+    return read_to(std::string_view(skip_whitespace(first, last), last), value);
+  } else {
+    first = read_char(first, last, '[');
+    for (std::size_t i = 0; i < std::size(value); ++i) {
+      if (i != 0) {
+        first = read_char(first, last, ',');
+      }
+      first = read_block(first, last, value[i]);
+    }
+    return read_char(first, last, ']');
+  }
+}
+
+/**
+ * @brief reads an array of numeric blocks directly into the storage of value
+ */
+template<class T>
+constexpr const char* read_sequence(const char* first, const char* last, T& value) {
+  value.clear();
+
+  first = skip_whitespace(read_char(first, last, '['), last);
+  if (first != last && *first == ']') {
+    return std::next(first);
+  }
+
+  while (first != last) {
+    first = skip_whitespace(read_block(first, last, value.emplace_back()), last);
+
+    if (first != last && *first == ']') {
+      return std::next(first);
+    }
+    first = read_char(first, last, ',');
+  }
+
+  assert(false && "missing ] character");
+  return first;
+}
+
+/**
+ * @brief writes numeric blocks through a buffer on the stack, which is flushed as one run of characters
+ */
+template<class OutputIt>
+class block_writer {
+public:
+  explicit block_writer(OutputIt out) noexcept : m_out(out) {}
+
+  block_writer(const block_writer&) = delete;
+  block_writer& operator=(const block_writer&) = delete;
+
+  ~block_writer() { flush(); }
+
+  template<class T>
+  void write(const T& value) {
+    if constexpr (is_number_v<T>) {
+      static_assert(number_helper::max_size_v<T> <= capacity, "a number has to fit into the empty buffer");
+      reserve(number_helper::max_size_v<T>);
+      m_pos = number_helper::format(m_pos, value);
+    } else {
+      write_range(value);
+    }
+  }
+
+  template<class R>
+  void write_range(const R& range) {
+    put('[');
+    bool first = true;
+    for (const auto& element : range) {
+      if (!first) {
+        put(',');
+      }
+      write(element);
+      first = false;
+    }
+    put(']');
+  }
+
+private:
+  // at least one number of every type, e.g. the thousands of digits of a fixed long double
+  static constexpr std::size_t capacity = std::max<std::size_t>(4096, number_helper::max_size_v<long double>);
+
+  void reserve(std::size_t size) {
+    if (static_cast<std::size_t>(std::end(m_buffer) - m_pos) < size) {
+      flush();
+    }
+  }
+
+  void put(char c) {
+    reserve(1);
+    *m_pos++ = c;
+  }
+
+  void flush() {
+    detail::write_chars(m_out, std::string_view(std::data(m_buffer), m_pos));
+    m_pos = std::data(m_buffer);
+  }
+
+  OutputIt m_out;
+  std::array<char, capacity> m_buffer;
+  char* m_pos = std::data(m_buffer);
+};
+
+} // namespace array_helper
+
 template<cpt::range_like T>
 constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  if constexpr (array_helper::is_numeric_block_v<std::ranges::range_value_t<T>>) {
+    if (!std::is_constant_evaluated()) {
+      array_helper::block_writer(out).write_range(value);
+      return;
+    }
+  }
+
   out = '[';
 
   bool first = true;
@@ -317,6 +787,10 @@ template<cpt::range_like T>
 constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
   static_assert(!detail::is_span_v<std::remove_cvref<T>> && "std::span is non owning!");
 
+  if constexpr (array_helper::is_numeric_sequence_v<T>) {
+    return array_helper::read_sequence(std::data(sv), std::data(sv) + std::size(sv), value);
+  }
+
   parser::trim(sv);
   auto iter = std::data(sv);
 
@@ -371,33 +845,125 @@ constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)
   return std::begin(sv);
 }
 
-template<cpt::public_struct T>
-  requires(!std::ranges::range<T> &&                                              // no ranges
-           !cpt::tuple_like<T> &&                                                 // no tuple
-           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional> // no optional
-  )
-constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
-  out = '{';
+namespace struct_helper {
 
-  bool isFirst = true;
+// a struct which is written as json object, see the struct write_to
+template<class T>
+concept object_struct = cpt::public_struct<T> && !std::ranges::range<T> && !cpt::tuple_like<T> &&
+                        !detail::is_dynamic_value_v<T> && !detail::is_tagged_union_v<T> &&
+                        !detail::is_specialization_of_v<T, std::variant> &&
+                        !detail::is_specialization_of_v<T, std::optional> && !detail::is_positional_v<T>;
+
+template<class T>
+struct members {
+  static constexpr auto names = meta::structMemberNames<T>();
+  static constexpr auto pointers = meta::structAsPtrToMem<T>();
+};
+
+template<class T, class F, std::size_t... Is>
+constexpr void for_each_member(F&& f, std::index_sequence<Is...>) {
+  (f(std::integral_constant<std::size_t, Is>{}), ...);
+}
+
+template<class T, class F>
+constexpr void for_each_member(F&& f) {
+  for_each_member<T>(f, std::make_index_sequence<meta::memberCount<T>>{});
+}
+
+// the operator== of the standard containers is not constrained, so they are compared element by element
+template<class T>
+constexpr bool equal(const T& a, const T& b) {
+  if constexpr (object_struct<T> && !std::equality_comparable<T>) {
+    bool result = true;
+    for_each_member<T>([&](auto i) {
+      constexpr auto pointer = std::get<i>(members<T>::pointers);
+      result = result && equal(a.*pointer, b.*pointer);
+    });
+    return result;
+  } else if constexpr (detail::is_specialization_of_v<T, std::optional>) {
+    return a.has_value() == b.has_value() && (!a.has_value() || equal(*a, *b));
+  } else if constexpr (cpt::map_like<T>) {
+    return std::size(a) == std::size(b) && std::ranges::all_of(a, [&b](const auto& entry) {
+             const auto search = b.find(entry.first);
+             return search != std::end(b) && equal(entry.second, search->second);
+           });
+  } else if constexpr (cpt::range_like<T>) {
+    return std::ranges::equal(a, b, [](const auto& x, const auto& y) { return equal(x, y); });
+  } else {
+    return a == b;
+  }
+}
+
+// is the member not written because of the member_omission_v of its struct T
+template<class T, class M>
+constexpr bool is_omitted(const M& member) {
+  constexpr auto omission = member_omission_v<std::remove_cvref_t<T>>;
+
+  if constexpr (omission == member_omission::null && detail::is_specialization_of_v<M, std::optional>) {
+    return !member.has_value();
+  } else if constexpr (omission == member_omission::default_value && std::is_default_constructible_v<M>) {
+    return equal(member, M{});
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief writes the members of a struct as "name":value pairs without the surrounding braces
+ *
+ * @param isFirst false if a member has already been written in front of them
+ * @param exclude the name of a member which is not written
+ */
+template<class T>
+constexpr void write_members(std::output_iterator<const char&> auto out,
+                             T&& value,
+                             bool isFirst = true,
+                             std::string_view exclude = {}) {
+  [[maybe_unused]] std::size_t index = 0;
 
   meta::map_tuple_elements(meta::structAsNamedTuple(value), [&](auto&& t) {
     const auto& [name, member] = t;
 
+    if (name == exclude || is_omitted<T>(member)) {
+      ++index;
+      return;
+    }
+
     if (!isFirst) {
       out = ',';
     }
     out = '\"';
-    std::copy(std::begin(name), std::end(name), out); // [INFO] c++20 ranges
+    detail::write_chars(out, name);
     out = '\"';
     out = ':';
 
+    JFLECT_TRACE_WRITE_MEMBER(T, index++); // only the value, like the consumed bytes of a read
     write_to(out, member);
 
     isFirst = false;
   });
+}
 
-  out = '}';
+} // namespace struct_helper
+
+template<cpt::public_struct T>
+  requires(!std::ranges::range<T> &&                                                // no ranges
+           !cpt::tuple_like<T> &&                                                   // no tuple
+           !detail::is_dynamic_value_v<std::remove_cvref_t<T>> &&                   // no jflect::value
+           !detail::is_tagged_union_v<std::remove_cvref_t<T>> &&                    // no tagged_union
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::variant> && // no variant
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional>   // no optional
+  )
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  JFLECT_TRACE_WRITE(T);
+
+  if constexpr (detail::is_positional_v<T>) {
+    write_to(out, meta::structAsTuple(value)); // written like a tuple
+  } else {
+    out = '{';
+    struct_helper::write_members(out, value);
+    out = '}';
+  }
 }
 
 namespace struct_helper {
@@ -411,6 +977,7 @@ public:
   std::string_view key;
   fn read;
   bool default_constructible;
+  void (*reset)(T& value); // value initializes a member which is missing, nullptr if it is not default constructible
 };
 
 template<class T>
@@ -418,68 +985,113 @@ struct Reader {
   static constexpr auto memberNames = meta::structMemberNames<T>();
   static constexpr auto ptrToMembers = meta::structAsPtrToMem<T>();
 
+  template<std::size_t I>
+  using member_type = std::remove_cvref_t<decltype(std::declval<T&>().*std::get<I>(ptrToMembers))>;
+
   template<std::size_t... Is>
   static constexpr auto create_map_impl(std::index_sequence<Is...>) noexcept {
     return std::array{MapValue<T>{
         .key = memberNames[Is],
         .read = [](std::string_view sv, T& value) -> const char* {
-          return read_to(sv, value.*std::get<Is>(ptrToMembers));
+          JFLECT_TRACE_READ_MEMBER(T, Is, sv);
+          return jflectTrace.done(read_to(sv, value.*std::get<Is>(ptrToMembers)));
         },
-        .default_constructible = std::is_default_constructible_v<std::tuple_element_t<Is, meta::struct_types<T>>>,
+        .default_constructible = std::is_default_constructible_v<member_type<Is>>,
+        .reset = reset<Is>(),
     }...};
   }
 
+  template<std::size_t I>
+  static constexpr auto reset() noexcept -> void (*)(T&) {
+    if constexpr (std::is_default_constructible_v<member_type<I>>) {
+      return [](T& value) { value.*std::get<I>(ptrToMembers) = member_type<I>{}; };
+    } else {
+      return nullptr;
+    }
+  }
+
   static constexpr auto create_map() noexcept {
     return create_map_impl(std::make_index_sequence<meta::memberCount<T>>{});
   }
 };
 
+// reads the members of a positional struct in declaration order without any key lookup
+template<class T>
+constexpr auto read_positional(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  constexpr auto map = Reader<T>::create_map();
+
+  parser::trim_read(sv, '[');
+
+  for (std::size_t i = 0; i < std::size(map); ++i) {
+    if (i != 0) {
+      parser::trim_read(sv, ',');
+    }
+    sv = std::string_view(map[i].read(sv, value), std::end(sv));
+  }
+
+  parser::trim_read(sv, ']');
+
+  return std::begin(sv);
+}
+
 } // namespace struct_helper
 
 // [TODO] use hash-map (or similar) if there are many struct members instead of a linear search
 template<cpt::public_struct T>
-  requires(!std::ranges::range<T> &&                                              // no ranges
-           !cpt::tuple_like<T> &&                                                 // no tuple
-           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional> // no optional
+  requires(!std::ranges::range<T> &&                                                // no ranges
+           !cpt::tuple_like<T> &&                                                   // no tuple
+           !detail::is_dynamic_value_v<std::remove_cvref_t<T>> &&                   // no jflect::value
+           !detail::is_tagged_union_v<std::remove_cvref_t<T>> &&                    // no tagged_union
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::variant> && // no variant
+           !detail::is_specialization_of_v<std::remove_cvref_t<T>, std::optional>   // no optional
   )
 constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
   using namespace struct_helper;
+  JFLECT_TRACE_READ(T, sv);
+
+  if constexpr (detail::is_positional_v<T>) {
+    return jflectTrace.done(read_positional(sv, value));
+  }
+
   constexpr auto map = Reader<T>::create_map();
 
   std::array<bool, meta::memberCount<T>> is_initialized{};
 
   parser::trim_read(sv, '{');
+  parser::trim(sv);
 
-  for (;;) {
-    parser::trim_read(sv, '"');
+  if (!sv.starts_with('}')) { // an empty object if all members were omitted
+    for (;;) {
+      parser::trim_read(sv, '"');
 
-    const auto endQuotePos = sv.find('"');
-    assert(endQuotePos != std::string_view::npos);
+      const auto endQuotePos = sv.find('"');
+      assert(endQuotePos != std::string_view::npos);
 
-    const auto key = sv.substr(0, endQuotePos);
+      const auto key = sv.substr(0, endQuotePos);
 
-    sv.remove_prefix(endQuotePos + 1);
+      sv.remove_prefix(endQuotePos + 1);
 
-    parser::trim_read(sv, ':');
+      parser::trim_read(sv, ':');
 
-    const auto search = std::find_if(std::begin(map), std::end(map), [&key](const auto& p) {
-      return p.key == key;
-    }); // [INFO] c++20 ranges with projection
-    // const auto search = std::ranges::find(map, key, MapValue::key);
+      const auto search = std::find_if(std::begin(map), std::end(map), [&key](const auto& p) {
+        return p.key == key;
+      }); // [INFO] c++20 ranges with projection
+      // const auto search = std::ranges::find(map, key, MapValue::key);
 
-    if (search != std::end(map)) {
-      sv = std::string_view(search->read(sv, value), std::end(sv));
-      const auto index = search - std::begin(map);
-      is_initialized[index] = true;
-    } else {
-      sv = parser::read_value(sv);
-    }
+      if (search != std::end(map)) {
+        sv = std::string_view(search->read(sv, value), std::end(sv));
+        const auto index = search - std::begin(map);
+        is_initialized[index] = true;
+      } else {
+        sv = parser::skip_value(sv);
+      }
 
-    parser::trim(sv);
+      parser::trim(sv);
 
-    if (parser::optional_read(sv, ','))
-      continue;
-    break;
+      if (parser::optional_read(sv, ','))
+        continue;
+      break;
+    }
   }
 
   parser::read(sv, '}');
@@ -488,6 +1100,12 @@ constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)
   // have all members been initalized?
   for (std::size_t i = 0; i < meta::memberCount<T>; ++i) {
     assert(is_initialized[i] || map[i].default_constructible);
+    if constexpr (detail::omits_members_v<T>) {
+      // members which are not default constructible are never omitted, missing ones are asserted above
+      if (!is_initialized[i] && map[i].reset != nullptr) {
+        map[i].reset(value); // an omitted member has its value initialized value
+      }
+    }
   }
 
   /*
@@ -524,11 +1142,18 @@ constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)
   parser::trim_read(sv, '}');
   */
 
-  return std::begin(sv);
+  return jflectTrace.done(std::begin(sv));
 }
 
 template<cpt::tuple_like T>
 constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  if constexpr (array_helper::is_numeric_block_v<T>) {
+    if (!std::is_constant_evaluated()) {
+      array_helper::block_writer(out).write(value);
+      return;
+    }
+  }
+
   out = '[';
 
   bool isFirst = true;
@@ -569,6 +1194,10 @@ constexpr T read(std::string_view& sv, std::index_sequence<I...>) {
 
 template<cpt::tuple_like T>
 constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  if constexpr (array_helper::is_numeric_block_v<T>) {
+    return array_helper::read_block(std::data(sv), std::data(sv) + std::size(sv), value);
+  }
+
   parser::trim_read(sv, '[');
 
   value = tuple_like::read<T>(sv, std::make_index_sequence<std::tuple_size_v<T>>{});
@@ -585,7 +1214,7 @@ constexpr void write_to(std::output_iterator<const char&> auto out, const std::o
     write_to(out, value.value());
   } else {
     const auto null = std::string_view("null");
-    std::copy(std::begin(null), std::end(null), out);
+    detail::write_chars(out, null);
   }
 }
 
@@ -602,18 +1231,247 @@ constexpr auto read_to(std::string_view sv, std::optional<T>& value) -> decltype
   return iter;
 }
 
-// [TODO] basic std::variant support
-// std::fundamental || range || tuple_like || non colliding struct
+template<class... Ts>
+constexpr void write_to(std::output_iterator<const char&> auto out, const std::variant<Ts...>& value) {
+  std::visit(
+      [&out](const auto& alternative) {
+        if constexpr (std::same_as<std::remove_cvref_t<decltype(alternative)>, std::monostate>) {
+          const auto null = std::string_view("null");
+          detail::write_chars(out, null);
+        } else {
+          write_to(out, alternative);
+        }
+      },
+      value);
+}
+
+namespace variant_helper {
+
+template<class T>
+inline constexpr bool is_struct_v = cpt::public_struct<T> &&                                // struct
+                                    !std::ranges::range<T> &&                                // no ranges
+                                    !cpt::tuple_like<T> &&                                   // no tuple
+                                    !detail::is_dynamic_value_v<T> &&                        // no jflect::value
+                                    !detail::is_tagged_union_v<T> &&                         // no tagged_union
+                                    !detail::is_specialization_of_v<T, std::variant> &&      // no variant
+                                    !detail::is_specialization_of_v<T, std::optional> &&     // no optional
+                                    !std::same_as<T, std::monostate>;                        // no monostate
+
+// can T be read from a json-value of the given type?
+template<class T>
+constexpr bool accepts(parser::value_type type) noexcept {
+  using parser::value_type;
+  if constexpr (std::same_as<T, std::monostate>) {
+    return type == value_type::null;
+  } else if constexpr (detail::is_specialization_of_v<T, std::optional>) {
+    return type == value_type::null || accepts<typename T::value_type>(type);
+  } else if constexpr (detail::is_dynamic_value_v<T>) {
+    return true;
+  } else if constexpr (std::same_as<T, bool>) {
+    return type == value_type::boolean;
+  } else if constexpr (std::is_arithmetic_v<T>) {
+    return type == value_type::number;
+  } else if constexpr (cpt::enumeration<T>) {
+    return (detail::encodes_enum_name_v<T> && type == value_type::string) ||
+           (detail::encodes_enum_integer_v<T> && type == value_type::number);
+  } else if constexpr (cpt::string_like<T>) {
+    return type == value_type::string;
+  } else if constexpr (is_struct_v<T> && detail::is_positional_v<T>) {
+    return type == value_type::array;
+  } else if constexpr (cpt::map_like<T> || is_struct_v<T> || detail::is_tagged_union_v<T>) {
+    return type == value_type::object;
+  } else if constexpr (cpt::range_like<T> || cpt::tuple_like<T>) {
+    return type == value_type::array;
+  } else {
+    return false;
+  }
+}
+
+template<class T>
+consteval auto struct_member_names() noexcept {
+  if constexpr (is_struct_v<T> && !detail::is_positional_v<T>) {
+    return meta::structMemberNames<T>();
+  } else {
+    return std::array<std::string_view, 0>{};
+  }
+}
+
+struct discriminator {
+  std::string_view key;
+  std::size_t index;
+};
+
+/**
+ * @brief a sorted table of the member names which only occur in a single struct alternative
+ *
+ * If an object has one of these keys, it can only be read by the corresponding alternative.
+ */
+template<class... Ts>
+struct discriminators {
+  static constexpr auto all = [] {
+    std::array<discriminator, (std::size(struct_member_names<Ts>()) + ... + 0)> result{};
+    auto out = std::begin(result);
+    std::size_t index = 0;
+    (
+        [&] {
+          for (const auto name : struct_member_names<Ts>()) {
+            *out++ = {name, index};
+          }
+          ++index;
+        }(),
+        ...);
+    std::sort(std::begin(result), std::end(result), [](const auto& a, const auto& b) { return a.key < b.key; });
+    return result;
+  }();
+
+  static constexpr bool is_unique(std::size_t i) noexcept {
+    const auto key = all[i].key;
+    return (i == 0 || all[i - 1].key != key) && (i + 1 == std::size(all) || all[i + 1].key != key);
+  }
+
+  static constexpr auto table = [] {
+    constexpr auto uniqueCount = [] {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < std::size(all); ++i) {
+        count += is_unique(i);
+      }
+      return count;
+    }();
+
+    std::array<discriminator, uniqueCount> result{};
+    auto out = std::begin(result);
+    for (std::size_t i = 0; i < std::size(all); ++i) {
+      if (is_unique(i)) {
+        *out++ = all[i];
+      }
+    }
+    return result;
+  }();
+
+  static constexpr std::optional<std::size_t> find(std::string_view key) noexcept {
+    const auto iter = std::lower_bound(
+        std::begin(table), std::end(table), key, [](const auto& d, std::string_view k) { return d.key < k; });
+    if (iter != std::end(table) && iter->key == key)
+      return iter->index;
+    return std::nullopt;
+  }
+};
+
+// looks for the first key which only occurs in one of the candidates
+template<class... Ts>
+constexpr std::optional<std::size_t> find_discriminated(std::string_view sv,
+                                                       const std::array<bool, sizeof...(Ts)>& candidates) {
+  parser::trim_read_trim(sv, '{');
+
+  while (sv.starts_with('"')) {
+    const auto afterKey = parser::skip_string(sv);
+    const auto key = sv.substr(1, std::size(sv) - std::size(afterKey) - 2);
+
+    if (const auto index = discriminators<Ts...>::find(key); index && candidates[*index])
+      return index;
+
+    sv = afterKey;
+    parser::trim_read(sv, ':');
+    sv = parser::skip_value(sv);
+    parser::trim(sv);
+    if (!parser::optional_read(sv, ','))
+      break;
+    parser::trim(sv);
+  }
+
+  return std::nullopt;
+}
+
+/**
+ * @brief selects the alternative to read without trial parsing
+ *
+ * The first character of the value determines which alternatives are possible. Numbers prefer integral or floating
+ * point alternatives depending on their notation and objects are dispatched by keys which only occur in a single
+ * struct alternative.
+ *
+ * @return the index of the selected alternative or sizeof...(Ts) if no alternative can read the value
+ */
+template<class... Ts>
+constexpr std::size_t select(std::string_view sv) {
+  constexpr auto size = sizeof...(Ts);
+
+  const auto type = parser::peek_type(sv);
+  const auto candidates = std::array<bool, size>{accepts<Ts>(type)...};
+  const auto candidateCount = static_cast<std::size_t>(std::count(std::begin(candidates), std::end(candidates), true));
+
+  if (candidateCount > 1 && type == parser::value_type::number) {
+    constexpr auto isIntegral = std::array<bool, size>{(std::is_integral_v<Ts> || cpt::enumeration<Ts>)...};
+
+    parser::trim(sv);
+    const auto number = sv.substr(0, std::size(sv) - std::size(parser::read_number(sv)));
+    const auto isIntegralNumber = number.find_first_of(".eE") == std::string_view::npos;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      if (candidates[i] && isIntegral[i] == isIntegralNumber)
+        return i;
+    }
+  }
+
+  if (candidateCount > 1 && type == parser::value_type::object) {
+    if (const auto index = find_discriminated<Ts...>(sv, candidates))
+      return *index;
+  }
+
+  return static_cast<std::size_t>(std::find(std::begin(candidates), std::end(candidates), true) -
+                                  std::begin(candidates));
+}
+
+template<class V, std::size_t... Is>
+constexpr auto read_alternative(std::string_view sv, V& value, std::size_t index, std::index_sequence<Is...>)
+    -> decltype(std::begin(sv)) {
+  using fn = const char* (*)(std::string_view sv, V& value);
+
+  constexpr fn readers[] = {[](std::string_view sv, V& value) -> const char* {
+    auto& alternative = value.template emplace<Is>();
+    if constexpr (std::same_as<std::variant_alternative_t<Is, V>, std::monostate>) {
+      return std::begin(parser::read_other(sv));
+    } else {
+      return read_to(sv, alternative);
+    }
+  }...};
+
+  return readers[index](sv, value);
+}
+
+} // namespace variant_helper
+
+template<class... Ts>
+constexpr auto read_to(std::string_view sv, std::variant<Ts...>& value) -> decltype(std::begin(sv)) {
+  const auto index = variant_helper::select<Ts...>(sv);
+  assert(index < sizeof...(Ts) && "no alternative can be read from this value");
+
+  return variant_helper::read_alternative(sv, value, index, std::index_sequence_for<Ts...>{});
+}
 
 /*----------------------------------------------------------------------------*/
 
 template<class T>
 CONSTEXPR_20_STRING std::string write(T&& value) {
   std::string str;
-  write_to(std::back_inserter(str), std::forward<T>(value));
+  write_to(JFLECT_TRACE_OUTPUT(detail::string_appender(str)), std::forward<T>(value));
   return str;
 }
 
+/**
+ * @brief writes value into caller memory without allocating
+ *
+ * Runs of characters (strings, numbers, member names) are stored at once. If the buffer is too small it is filled and
+ * the rest is only counted, so the result tells the required size.
+ */
+template<class T>
+constexpr buffer_result write_to_buffer(std::span<char> buffer, T&& value) {
+  auto bounded = detail::bounded_buffer{std::data(buffer), std::data(buffer) + std::size(buffer)};
+  write_to(detail::bounded_iterator(bounded), std::forward<T>(value));
+
+  const auto written = static_cast<std::size_t>(bounded.pos - std::data(buffer));
+  return {written + bounded.overflow, bounded.overflow != 0};
+}
+
 template<class T>
   requires(std::is_default_constructible_v<T>)
 constexpr T read(std::string_view sv) {
@@ -622,5 +1480,28 @@ constexpr T read(std::string_view sv) {
   return result;
 }
 
+/*---------------------------------- codec -----------------------------------*/
+// not inline, so that JFLECT_DECLARE_CODEC suppresses their instantiation
+
+template<class T>
+std::string codec<T>::write(const T& value) {
+  return jflect::write(value);
+}
+
+template<class T>
+buffer_result codec<T>::write_to_buffer(std::span<char> buffer, const T& value) {
+  return jflect::write_to_buffer(buffer, value);
+}
+
+template<class T>
+const char* codec<T>::read_to(std::string_view sv, T& value) {
+  return jflect::read_to(sv, value);
+}
+
+template<class T>
+T codec<T>::read(std::string_view sv) {
+  return jflect::read<T>(sv);
+}
+
 } // namespace jflect
 #endif // JFLECT_JFLECT_HPP_
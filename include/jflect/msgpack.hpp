@@ -0,0 +1,765 @@
+#ifndef JFLECT_MSGPACK_HPP_
+#define JFLECT_MSGPACK_HPP_
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+
+#include "concepts.hpp"
+#include "helper.hpp"
+#include "jflect.hpp"
+#include "meta.hpp"
+#include "traits.hpp"
+
+/**
+ * MessagePack (https://github.com/msgpack/msgpack/blob/master/spec.md) backend which uses the same reflection metadata
+ * as the json backend:
+ *
+ * - structs and maps are written as maps with string keys, positional structs as arrays
+ * - enumerations are written as the name of their enumerator or as integer (see enum_encoding_v)
+ * - ranges and tuples are written as arrays
+ * - an empty std::optional is written as nil
+ *
+ * The binary data is stored in a std::string (written) or viewed by a std::string_view (read).
+ */
+namespace jflect::msgpack {
+
+namespace format {
+inline constexpr unsigned char positive_fixint_max = 0x7f;
+inline constexpr unsigned char fixmap = 0x80;
+inline constexpr unsigned char fixarray = 0x90;
+inline constexpr unsigned char fixstr = 0xa0;
+inline constexpr unsigned char nil = 0xc0;
+inline constexpr unsigned char false_value = 0xc2;
+inline constexpr unsigned char true_value = 0xc3;
+inline constexpr unsigned char bin8 = 0xc4;
+inline constexpr unsigned char bin16 = 0xc5;
+inline constexpr unsigned char bin32 = 0xc6;
+inline constexpr unsigned char ext8 = 0xc7;
+inline constexpr unsigned char ext16 = 0xc8;
+inline constexpr unsigned char ext32 = 0xc9;
+inline constexpr unsigned char float32 = 0xca;
+inline constexpr unsigned char float64 = 0xcb;
+inline constexpr unsigned char uint8 = 0xcc;
+inline constexpr unsigned char uint16 = 0xcd;
+inline constexpr unsigned char uint32 = 0xce;
+inline constexpr unsigned char uint64 = 0xcf;
+inline constexpr unsigned char int8 = 0xd0;
+inline constexpr unsigned char int16 = 0xd1;
+inline constexpr unsigned char int32 = 0xd2;
+inline constexpr unsigned char int64 = 0xd3;
+inline constexpr unsigned char fixext1 = 0xd4;
+inline constexpr unsigned char fixext2 = 0xd5;
+inline constexpr unsigned char fixext4 = 0xd6;
+inline constexpr unsigned char fixext8 = 0xd7;
+inline constexpr unsigned char fixext16 = 0xd8;
+inline constexpr unsigned char str8 = 0xd9;
+inline constexpr unsigned char str16 = 0xda;
+inline constexpr unsigned char str32 = 0xdb;
+inline constexpr unsigned char array16 = 0xdc;
+inline constexpr unsigned char array32 = 0xdd;
+inline constexpr unsigned char map16 = 0xde;
+inline constexpr unsigned char map32 = 0xdf;
+inline constexpr unsigned char negative_fixint = 0xe0;
+} // namespace format
+
+namespace detail {
+
+template<std::size_t N>
+constexpr void write_big_endian(std::output_iterator<const char&> auto& out, std::uint64_t value) {
+  for (std::size_t i = N; i-- > 0;) {
+    out = static_cast<char>(static_cast<unsigned char>(value >> (8u * i)));
+  }
+}
+
+constexpr std::uint64_t read_big_endian(std::string_view sv, std::size_t n) noexcept {
+  assert(std::size(sv) >= n && "unexpected end of input");
+  std::uint64_t result = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    result = (result << 8u) | static_cast<unsigned char>(sv[i]);
+  }
+  return result;
+}
+
+constexpr unsigned char peek(std::string_view sv) noexcept {
+  assert(!sv.empty() && "unexpected end of input");
+  return static_cast<unsigned char>(sv.front());
+}
+
+// writes the header of a str, array or map with the given size
+constexpr void write_header(std::output_iterator<const char&> auto& out,
+                            std::size_t size,
+                            unsigned char fix,
+                            std::size_t fixMax,
+                            unsigned char size8,
+                            unsigned char size16,
+                            unsigned char size32) {
+  if (size <= fixMax) {
+    out = static_cast<char>(fix | size);
+  } else if (size8 != 0 && size <= 0xff) {
+    out = static_cast<char>(size8);
+    write_big_endian<1>(out, size);
+  } else if (size <= 0xffff) {
+    out = static_cast<char>(size16);
+    write_big_endian<2>(out, size);
+  } else {
+    assert(size <= 0xffffffff && "too large for messagepack");
+    out = static_cast<char>(size32);
+    write_big_endian<4>(out, size);
+  }
+}
+
+constexpr void write_str_header(std::output_iterator<const char&> auto& out, std::size_t size) {
+  write_header(out, size, format::fixstr, 31, format::str8, format::str16, format::str32);
+}
+
+constexpr void write_array_header(std::output_iterator<const char&> auto& out, std::size_t size) {
+  write_header(out, size, format::fixarray, 15, 0, format::array16, format::array32);
+}
+
+constexpr void write_map_header(std::output_iterator<const char&> auto& out, std::size_t size) {
+  write_header(out, size, format::fixmap, 15, 0, format::map16, format::map32);
+}
+
+constexpr void write_str(std::output_iterator<const char&> auto& out, std::string_view str) {
+  write_str_header(out, std::size(str));
+  std::copy(std::begin(str), std::end(str), out);
+}
+
+/**
+ * @brief reads the header of a str, array or map
+ *
+ * @return the number of bytes, elements or members
+ */
+constexpr std::size_t read_header(std::string_view& sv,
+                                  unsigned char fix,
+                                  unsigned char fixMask,
+                                  unsigned char size8,
+                                  unsigned char size16,
+                                  unsigned char size32) {
+  const auto c = peek(sv);
+  sv.remove_prefix(1);
+
+  std::size_t bytes = 0;
+  if ((c & ~fixMask) == fix) {
+    return c & fixMask;
+  } else if (size8 != 0 && c == size8) {
+    bytes = 1;
+  } else if (c == size16) {
+    bytes = 2;
+  } else if (c == size32) {
+    bytes = 4;
+  } else {
+    assert(false && "unexpected type");
+    return 0;
+  }
+
+  const auto size = static_cast<std::size_t>(read_big_endian(sv, bytes));
+  sv.remove_prefix(bytes);
+  return size;
+}
+
+constexpr std::size_t read_str_header(std::string_view& sv) {
+  return read_header(sv, format::fixstr, 0x1f, format::str8, format::str16, format::str32);
+}
+
+constexpr std::size_t read_array_header(std::string_view& sv) {
+  return read_header(sv, format::fixarray, 0x0f, 0, format::array16, format::array32);
+}
+
+constexpr std::size_t read_map_header(std::string_view& sv) {
+  return read_header(sv, format::fixmap, 0x0f, 0, format::map16, format::map32);
+}
+
+constexpr std::string_view read_str(std::string_view& sv) {
+  const auto size = read_str_header(sv);
+  assert(std::size(sv) >= size && "unexpected end of input");
+  const auto str = sv.substr(0, size);
+  sv.remove_prefix(size);
+  return str;
+}
+
+/**
+ * @brief skips a messagepack value
+ *
+ * @return a std::string_view past the value
+ */
+constexpr std::string_view skip(std::string_view sv) {
+  const auto c = peek(sv);
+
+  const auto skipBytes = [&sv](std::size_t n) {
+    assert(std::size(sv) >= n && "unexpected end of input");
+    sv.remove_prefix(n);
+  };
+  const auto skipSized = [&](std::size_t sizeBytes, std::size_t extra) {
+    skipBytes(1);
+    const auto size = static_cast<std::size_t>(read_big_endian(sv, sizeBytes));
+    skipBytes(sizeBytes + extra + size);
+  };
+  const auto skipElements = [&sv](std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      sv = skip(sv);
+    }
+  };
+
+  if (c <= format::positive_fixint_max || c >= format::negative_fixint) {
+    skipBytes(1);
+  } else if ((c & 0xf0u) == format::fixmap) {
+    skipBytes(1);
+    skipElements(2u * (c & 0x0fu));
+  } else if ((c & 0xf0u) == format::fixarray) {
+    skipBytes(1);
+    skipElements(c & 0x0fu);
+  } else if ((c & 0xe0u) == format::fixstr) {
+    skipBytes(1u + (c & 0x1fu));
+  } else {
+    switch (c) {
+      case format::nil:
+      case format::false_value:
+      case format::true_value:
+        skipBytes(1);
+        break;
+      case format::uint8:
+      case format::int8:
+        skipBytes(2);
+        break;
+      case format::uint16:
+      case format::int16:
+        skipBytes(3);
+        break;
+      case format::float32:
+      case format::uint32:
+      case format::int32:
+        skipBytes(5);
+        break;
+      case format::float64:
+      case format::uint64:
+      case format::int64:
+        skipBytes(9);
+        break;
+      case format::fixext1:
+        skipBytes(3);
+        break;
+      case format::fixext2:
+        skipBytes(4);
+        break;
+      case format::fixext4:
+        skipBytes(6);
+        break;
+      case format::fixext8:
+        skipBytes(10);
+        break;
+      case format::fixext16:
+        skipBytes(18);
+        break;
+      case format::bin8:
+      case format::str8:
+        skipSized(1, 0);
+        break;
+      case format::bin16:
+      case format::str16:
+        skipSized(2, 0);
+        break;
+      case format::bin32:
+      case format::str32:
+        skipSized(4, 0);
+        break;
+      case format::ext8:
+        skipSized(1, 1);
+        break;
+      case format::ext16:
+        skipSized(2, 1);
+        break;
+      case format::ext32:
+        skipSized(4, 1);
+        break;
+      case format::array16:
+      case format::array32:
+        skipElements(read_array_header(sv));
+        break;
+      case format::map16:
+      case format::map32:
+        skipElements(2u * read_map_header(sv));
+        break;
+      default:
+        assert(false && "unknown type");
+        skipBytes(1);
+        break;
+    }
+  }
+
+  return sv;
+}
+
+} // namespace detail
+
+template<class T>
+  requires(std::is_same_v<T, bool>)
+constexpr void write_to(std::output_iterator<const char&> auto out, T value) {
+  out = static_cast<char>(value ? format::true_value : format::false_value);
+}
+
+template<class T>
+  requires(std::is_same_v<T, bool>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  const auto c = detail::peek(sv);
+  assert((c == format::true_value || c == format::false_value) && "not a boolean");
+  value = c == format::true_value;
+  return std::begin(sv) + 1;
+}
+
+template<std::integral T>
+  requires(!std::same_as<T, bool>)
+constexpr void write_to(std::output_iterator<const char&> auto out, T value) {
+  if constexpr (std::is_signed_v<T>) {
+    if (value < 0) {
+      if (value >= -32) {
+        out = static_cast<char>(value);
+      } else if (value >= INT8_MIN) {
+        out = static_cast<char>(format::int8);
+        detail::write_big_endian<1>(out, static_cast<std::uint64_t>(value));
+      } else if (value >= INT16_MIN) {
+        out = static_cast<char>(format::int16);
+        detail::write_big_endian<2>(out, static_cast<std::uint64_t>(value));
+      } else if (value >= INT32_MIN) {
+        out = static_cast<char>(format::int32);
+        detail::write_big_endian<4>(out, static_cast<std::uint64_t>(value));
+      } else {
+        out = static_cast<char>(format::int64);
+        detail::write_big_endian<8>(out, static_cast<std::uint64_t>(value));
+      }
+      return;
+    }
+  }
+
+  const auto u = static_cast<std::uint64_t>(value);
+  if (u <= format::positive_fixint_max) {
+    out = static_cast<char>(u);
+  } else if (u <= UINT8_MAX) {
+    out = static_cast<char>(format::uint8);
+    detail::write_big_endian<1>(out, u);
+  } else if (u <= UINT16_MAX) {
+    out = static_cast<char>(format::uint16);
+    detail::write_big_endian<2>(out, u);
+  } else if (u <= UINT32_MAX) {
+    out = static_cast<char>(format::uint32);
+    detail::write_big_endian<4>(out, u);
+  } else {
+    out = static_cast<char>(format::uint64);
+    detail::write_big_endian<8>(out, u);
+  }
+}
+
+template<std::integral T>
+  requires(!std::same_as<T, bool>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  const auto c = detail::peek(sv);
+  sv.remove_prefix(1);
+
+  const auto readSigned = [&sv](std::size_t n) {
+    const auto bits = detail::read_big_endian(sv, n);
+    sv.remove_prefix(n);
+    const auto shift = 64u - 8u * static_cast<unsigned>(n);
+    return static_cast<std::int64_t>(bits << shift) >> shift; // sign extension
+  };
+  const auto readUnsigned = [&sv](std::size_t n) {
+    const auto bits = detail::read_big_endian(sv, n);
+    sv.remove_prefix(n);
+    return bits;
+  };
+
+  if (c <= format::positive_fixint_max) {
+    value = static_cast<T>(c);
+  } else if (c >= format::negative_fixint) {
+    value = static_cast<T>(static_cast<signed char>(c));
+  } else {
+    switch (c) {
+      // clang-format off
+      case format::uint8: value = static_cast<T>(readUnsigned(1)); break;
+      case format::uint16: value = static_cast<T>(readUnsigned(2)); break;
+      case format::uint32: value = static_cast<T>(readUnsigned(4)); break;
+      case format::uint64: value = static_cast<T>(readUnsigned(8)); break;
+      case format::int8: value = static_cast<T>(readSigned(1)); break;
+      case format::int16: value = static_cast<T>(readSigned(2)); break;
+      case format::int32: value = static_cast<T>(readSigned(4)); break;
+      case format::int64: value = static_cast<T>(readSigned(8)); break;
+      // clang-format on
+      default:
+        assert(false && "not an integer");
+        break;
+    }
+  }
+
+  return std::begin(sv);
+}
+
+template<std::floating_point T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T value) {
+  if constexpr (sizeof(T) <= sizeof(float)) {
+    out = static_cast<char>(format::float32);
+    detail::write_big_endian<4>(out, std::bit_cast<std::uint32_t>(static_cast<float>(value)));
+  } else {
+    out = static_cast<char>(format::float64);
+    detail::write_big_endian<8>(out, std::bit_cast<std::uint64_t>(static_cast<double>(value)));
+  }
+}
+
+template<std::floating_point T>
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  const auto c = detail::peek(sv);
+
+  if (c == format::float32) {
+    sv.remove_prefix(1);
+    value = static_cast<T>(std::bit_cast<float>(static_cast<std::uint32_t>(detail::read_big_endian(sv, 4))));
+    return std::begin(sv) + 4;
+  }
+  if (c == format::float64) {
+    sv.remove_prefix(1);
+    value = static_cast<T>(std::bit_cast<double>(detail::read_big_endian(sv, 8)));
+    return std::begin(sv) + 8;
+  }
+
+  // integers are accepted as well
+  std::int64_t integer{};
+  const auto iter = read_to(sv, integer);
+  value = static_cast<T>(integer);
+  return iter;
+}
+
+template<cpt::enumeration T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T value) {
+  if constexpr (jflect::detail::encodes_enum_integer_v<T>) {
+    write_to(out, static_cast<std::underlying_type_t<T>>(value));
+  } else {
+    detail::write_str(out, meta::enumerator_helper<T>::toString(value));
+  }
+}
+
+template<cpt::enumeration T>
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  if constexpr (jflect::detail::encodes_enum_integer_v<T>) {
+    const auto c = detail::peek(sv);
+    const auto isStr = (c & 0xe0u) == format::fixstr || c == format::str8 || c == format::str16 || c == format::str32;
+    if (!jflect::detail::encodes_enum_name_v<T> || !isStr) {
+      std::underlying_type_t<T> underlying{};
+      const auto iter = read_to(sv, underlying);
+      value = static_cast<T>(underlying);
+      return iter;
+    }
+  }
+
+  const auto result = meta::enumerator_helper<T>::fromString(detail::read_str(sv));
+  assert(static_cast<bool>(result));
+  if (result) {
+    value = *result;
+  }
+  return std::begin(sv);
+}
+
+template<cpt::string_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, const T& value) {
+  detail::write_str(out, std::string_view(std::data(value), std::size(value)));
+}
+
+// a std::string_view views the input, which is fine as msgpack strings are not escaped
+template<cpt::string_like T>
+constexpr auto read_to(std::string_view sv, T& value)
+    -> decltype(std::begin(sv)) requires(std::constructible_from<T, const char*, const char*>) {
+  const auto str = detail::read_str(sv);
+  value = T(std::begin(str), std::end(str));
+  return std::begin(sv);
+}
+
+constexpr void write_to(std::output_iterator<const char&> auto out, const char* value) {
+  write_to(out, std::string_view(value));
+}
+
+/*--------------------------- Forward Declarations ---------------------------*/
+template<cpt::range_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value);
+
+template<cpt::range_like T>
+  requires(cpt::reconstructible_range<T>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv));
+
+template<cpt::map_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value);
+
+template<cpt::map_like T>
+  requires(cpt::reconstructible_range<T>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv));
+
+template<cpt::public_struct T>
+  requires(variant_helper::is_struct_v<std::remove_cvref_t<T>>)
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value);
+
+template<cpt::public_struct T>
+  requires(variant_helper::is_struct_v<std::remove_cvref_t<T>>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv));
+
+template<cpt::tuple_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value);
+
+template<cpt::tuple_like T>
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv));
+
+template<class T>
+constexpr void write_to(std::output_iterator<const char&> auto out, const std::optional<T>& value);
+
+template<class T>
+constexpr auto read_to(std::string_view sv, std::optional<T>& value) -> decltype(std::begin(sv));
+
+/*----------------------------------------------------------------------------*/
+
+namespace detail {
+
+template<class R>
+struct read_array_iterator {
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::remove_cvref_t<std::ranges::range_reference_t<R>>;
+
+  std::reference_wrapper<std::string_view> m_sv;
+  std::size_t m_remaining;
+
+  constexpr value_type operator*() const {
+    value_type result{};
+    m_sv.get() = std::string_view(read_to(m_sv.get(), result), std::end(m_sv.get()));
+    return result;
+  }
+
+  constexpr read_array_iterator& operator++() noexcept {
+    --m_remaining;
+    return *this;
+  }
+
+  constexpr read_array_iterator operator++(int) noexcept {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr bool operator==(const jflect::detail::read_sentinel&) const noexcept { return m_remaining == 0; };
+};
+
+template<class R>
+struct read_map_iterator {
+  using iterator_category = std::input_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+
+  std::reference_wrapper<std::string_view> m_sv;
+  std::size_t m_remaining;
+
+  constexpr value_type operator*() const {
+    using key_type = std::remove_const_t<std::tuple_element_t<0, value_type>>;
+    using mapped_type = std::tuple_element_t<1, value_type>;
+
+    key_type key{};
+    m_sv.get() = std::string_view(read_to(m_sv.get(), key), std::end(m_sv.get()));
+
+    mapped_type mapped{};
+    m_sv.get() = std::string_view(read_to(m_sv.get(), mapped), std::end(m_sv.get()));
+
+    return {key, mapped};
+  }
+
+  constexpr read_map_iterator& operator++() noexcept {
+    --m_remaining;
+    return *this;
+  }
+
+  constexpr read_map_iterator operator++(int) noexcept {
+    auto tmp = *this;
+    ++(*this);
+    return tmp;
+  }
+
+  constexpr bool operator==(const jflect::detail::read_sentinel&) const noexcept { return m_remaining == 0; };
+};
+
+template<class T, class Iterator>
+constexpr void reconstruct(T& value, Iterator begin) {
+  const auto end = jflect::detail::read_sentinel{};
+
+  if constexpr (std::constructible_from<T, Iterator, jflect::detail::read_sentinel>) {
+    value = T(begin, end);
+  } else {
+    using common_iterator = std::common_iterator<Iterator, jflect::detail::read_sentinel>;
+    value = T(common_iterator(begin), common_iterator(end));
+  }
+}
+
+} // namespace detail
+
+template<cpt::range_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  detail::write_array_header(out, static_cast<std::size_t>(std::ranges::distance(value)));
+  for (auto&& element : value) {
+    write_to(out, element);
+  }
+}
+
+template<cpt::range_like T>
+  requires(cpt::reconstructible_range<T>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  const auto size = detail::read_array_header(sv);
+  detail::reconstruct(value, detail::read_array_iterator<T>{sv, size});
+  return std::begin(sv);
+}
+
+template<cpt::map_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  detail::write_map_header(out, static_cast<std::size_t>(std::ranges::distance(value)));
+  for (const auto& [key, mapped] : value) {
+    write_to(out, key);
+    write_to(out, mapped);
+  }
+}
+
+template<cpt::map_like T>
+  requires(cpt::reconstructible_range<T>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  const auto size = detail::read_map_header(sv);
+  detail::reconstruct(value, detail::read_map_iterator<T>{sv, size});
+  return std::begin(sv);
+}
+
+template<cpt::public_struct T>
+  requires(variant_helper::is_struct_v<std::remove_cvref_t<T>>)
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  if constexpr (jflect::detail::is_positional_v<T>) {
+    write_to(out, meta::structAsTuple(value));
+    return;
+  }
+
+  detail::write_map_header(out, meta::memberCount<std::remove_cvref_t<T>>);
+
+  meta::map_tuple_elements(meta::structAsNamedTuple(value), [&](auto&& t) {
+    const auto& [name, member] = t;
+    detail::write_str(out, name);
+    write_to(out, member);
+  });
+}
+
+namespace struct_helper {
+
+template<class T>
+struct Reader {
+  using fn = const char* (*)(std::string_view sv, T& value);
+
+  static constexpr auto ptrToMembers = meta::structAsPtrToMem<T>();
+
+  template<std::size_t... Is>
+  static constexpr auto create_readers(std::index_sequence<Is...>) noexcept {
+    return std::array<fn, sizeof...(Is)>{[](std::string_view sv, T& value) -> const char* {
+      return read_to(sv, value.*std::get<Is>(ptrToMembers));
+    }...};
+  }
+
+  static constexpr auto memberNames = meta::structMemberNames<T>();
+  static constexpr auto readers = create_readers(std::make_index_sequence<meta::memberCount<T>>{});
+};
+
+} // namespace struct_helper
+
+// unknown keys are skipped and missing members keep their value
+template<cpt::public_struct T>
+  requires(variant_helper::is_struct_v<std::remove_cvref_t<T>>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  using reader = struct_helper::Reader<T>;
+
+  if constexpr (jflect::detail::is_positional_v<T>) {
+    [[maybe_unused]] const auto count = detail::read_array_header(sv);
+    assert(count == std::size(reader::readers) && "member count mismatch");
+
+    for (const auto read : reader::readers) {
+      sv = std::string_view(read(sv, value), std::end(sv));
+    }
+    return std::begin(sv);
+  }
+
+  const auto size = detail::read_map_header(sv);
+
+  for (std::size_t i = 0; i < size; ++i) {
+    const auto key = detail::read_str(sv);
+
+    const auto search = std::find(std::begin(reader::memberNames), std::end(reader::memberNames), key);
+    if (search != std::end(reader::memberNames)) {
+      const auto index = static_cast<std::size_t>(search - std::begin(reader::memberNames));
+      sv = std::string_view(reader::readers[index](sv, value), std::end(sv));
+    } else {
+      sv = detail::skip(sv);
+    }
+  }
+
+  return std::begin(sv);
+}
+
+template<cpt::tuple_like T>
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  detail::write_array_header(out, std::tuple_size_v<std::remove_cvref_t<T>>);
+  meta::map_tuple_elements(value, [&out](auto&& element) { write_to(out, element); });
+}
+
+template<cpt::tuple_like T>
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  [[maybe_unused]] const auto size = detail::read_array_header(sv);
+  assert(size == std::tuple_size_v<T> && "tuple size mismatch");
+
+  std::apply([&sv](auto&... elements) { ((sv = std::string_view(read_to(sv, elements), std::end(sv))), ...); },
+             value);
+
+  return std::begin(sv);
+}
+
+template<class T>
+constexpr void write_to(std::output_iterator<const char&> auto out, const std::optional<T>& value) {
+  if (value.has_value()) {
+    write_to(out, value.value());
+  } else {
+    out = static_cast<char>(format::nil);
+  }
+}
+
+template<class T>
+constexpr auto read_to(std::string_view sv, std::optional<T>& value) -> decltype(std::begin(sv)) {
+  if (detail::peek(sv) == format::nil) {
+    value.reset();
+    return std::begin(sv) + 1;
+  }
+  T inner{};
+  const auto iter = read_to(sv, inner);
+  value = std::move(inner);
+  return iter;
+}
+
+/*----------------------------------------------------------------------------*/
+
+template<class T>
+CONSTEXPR_20_STRING std::string write(T&& value) {
+  std::string str;
+  write_to(std::back_inserter(str), std::forward<T>(value));
+  return str;
+}
+
+template<class T>
+  requires(std::is_default_constructible_v<T>)
+constexpr T read(std::string_view sv) {
+  T result;
+  read_to(sv, result);
+  return result;
+}
+
+} // namespace jflect::msgpack
+#endif // JFLECT_MSGPACK_HPP_
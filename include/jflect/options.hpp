@@ -0,0 +1,59 @@
+#ifndef JFLECT_OPTIONS_HPP_
+#define JFLECT_OPTIONS_HPP_
+#include <type_traits>
+
+/**
+ * Per type encoding options. They are selected by specializing the variable templates, e.g.
+ *
+ * template<>
+ * inline constexpr auto jflect::struct_encoding_v<Person> = jflect::struct_encoding::positional;
+ *
+ * Both sides of a connection have to use the same options.
+ */
+namespace jflect {
+
+enum struct struct_encoding {
+  object,    // {"name":"elizabeth","age":24}
+  positional // ["elizabeth",24], the members in declaration order
+};
+
+template<class T>
+inline constexpr struct_encoding struct_encoding_v = struct_encoding::object;
+
+enum struct enum_encoding {
+  name,           // "red"
+  integer,        // 2, the underlying value
+  integer_or_name // written as integer, both forms are accepted on read
+};
+
+template<class E>
+inline constexpr enum_encoding enum_encoding_v = enum_encoding::name;
+
+enum struct member_omission {
+  none,         // every member is written, an empty optional as null
+  null,         // members which are empty optionals are not written
+  default_value // members which equal their value initialized value are not written (if equality comparable)
+};
+
+// only for json objects, positional structs and msgpack write every member. Omitted members are value initialized on
+// read.
+template<class T>
+inline constexpr member_omission member_omission_v = member_omission::none;
+
+namespace detail {
+
+template<class T>
+inline constexpr bool is_positional_v = struct_encoding_v<std::remove_cvref_t<T>> == struct_encoding::positional;
+
+template<class T>
+inline constexpr bool omits_members_v = member_omission_v<std::remove_cvref_t<T>> != member_omission::none;
+
+template<class E>
+inline constexpr bool encodes_enum_name_v = enum_encoding_v<std::remove_cvref_t<E>> != enum_encoding::integer;
+
+template<class E>
+inline constexpr bool encodes_enum_integer_v = enum_encoding_v<std::remove_cvref_t<E>> != enum_encoding::name;
+
+} // namespace detail
+} // namespace jflect
+#endif // JFLECT_OPTIONS_HPP_
@@ -1,8 +1,36 @@
 #ifndef JFLECT_PARSER_HPP_
 #define JFLECT_PARSER_HPP_
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <string>
 #include <string_view>
+#include <type_traits>
 
 #include "helper.hpp"
+#include "simd.hpp"
+#include "utf8.hpp"
+
+/**
+ * Define JFLECT_VALIDATE_UTF8=1 to check that the content of every parsed json-string is well-formed utf-8. The check
+ * runs on the runs between escape sequences while they are scanned, so the input is not validated in a second pass.
+ *
+ * Unlike the asserts of the parser the check does not depend on NDEBUG: malformed utf-8 calls
+ * JFLECT_INVALID_UTF8(run), which asserts and aborts by default. Define it to reject the input differently, e.g. by
+ * throwing an exception.
+ */
+#ifndef JFLECT_VALIDATE_UTF8
+#define JFLECT_VALIDATE_UTF8 0
+#endif
+
+#ifndef JFLECT_INVALID_UTF8
+#define JFLECT_INVALID_UTF8(run) (assert(false && "malformed utf-8"), std::abort())
+#endif
 
 namespace jflect::parser {
 
@@ -53,6 +81,35 @@ constexpr bool optional_read_if(std::basic_string_view<CharT, Traits>& sv, Unary
 
 /*----------------------------------------------------------------------------*/
 
+enum struct value_type { null, boolean, number, string, array, object };
+
+/**
+ * @brief determines the type of a json-value from its first character
+ *
+ * @param sv a view from the begining of a json-value (leading whitespace is skipped)
+ * @return the type of the json-value
+ */
+template<class CharT, class Traits>
+constexpr value_type peek_type(std::basic_string_view<CharT, Traits> sv) noexcept {
+  trim(sv);
+  assert(!sv.empty());
+  switch (sv.front()) {
+    case '{':
+      return value_type::object;
+    case '[':
+      return value_type::array;
+    case '"':
+      return value_type::string;
+    case 't':
+    case 'f':
+      return value_type::boolean;
+    case 'n':
+      return value_type::null;
+    default:
+      return value_type::number;
+  }
+}
+
 template<class CharT, class Traits>
 constexpr std::basic_string_view<CharT, Traits> read_value(std::basic_string_view<CharT, Traits> sv);
 
@@ -100,55 +157,138 @@ constexpr std::basic_string_view<CharT, Traits> read_other(std::basic_string_vie
 }
 
 namespace detail {
+// the position of the first '"', '\\' or control character, which end a run of plain characters in a json-string
 template<class CharT, class Traits>
-constexpr std::basic_string_view<CharT, Traits> read_string_impl(std::basic_string_view<CharT, Traits> sv) {
-  [[maybe_unused]] const auto isHex = [](auto c) {
-    return ('0' <= c && c <= '9') || ('A' <= c && c <= 'F') || ('a' <= c && c <= 'f');
+constexpr std::size_t find_string_special(std::basic_string_view<CharT, Traits> sv) noexcept {
+  const auto isSpecial = [](CharT c) {
+    return c == '"' || c == '\\' || static_cast<std::make_unsigned_t<CharT>>(c) < 0x20u;
   };
 
+  if constexpr (std::same_as<CharT, char>) {
+    const auto first = std::data(sv);
+    const auto match = simd::find_if(
+        first,
+        first + std::size(sv),
+        [](const simd::block& b) { return b.any_of('"', '\\') | b.lt(0x20u); },
+        isSpecial);
+    return static_cast<std::size_t>(match - first);
+  } else {
+    return static_cast<std::size_t>(std::find_if(std::begin(sv), std::end(sv), isSpecial) - std::begin(sv));
+  }
+}
+
+// a run of plain characters of a json-string, not noexcept as JFLECT_INVALID_UTF8 may throw
+template<class CharT, class Traits>
+constexpr void check_run([[maybe_unused]] std::basic_string_view<CharT, Traits> run) {
+#if JFLECT_VALIDATE_UTF8
+  if constexpr (std::same_as<CharT, char>) {
+    if (!utf8::is_valid(run)) {
+      JFLECT_INVALID_UTF8(run);
+    }
+  }
+#endif
+}
+
+/**
+ * @brief reads the 4 hex digits of a \\u escape sequence, and the following low surrogate of a high surrogate
+ *
+ * @param sv a view past the u, which is moved past the escape sequence(s)
+ * @return the codepoint, U+FFFD for an unpaired surrogate
+ */
+template<class CharT, class Traits>
+constexpr std::uint32_t read_codepoint(std::basic_string_view<CharT, Traits>& sv) noexcept {
+  constexpr std::uint32_t replacement = 0xFFFDu;
+
+  const auto readHex = [](std::basic_string_view<CharT, Traits>& hex) -> std::uint32_t {
+    if (std::size(hex) < 4) {
+      assert(false && "incomplete unicode escape sequence");
+      hex = {};
+      return replacement;
+    }
+
+    std::uint32_t value = 0;
+    for (std::size_t i = 0; i < 4; ++i) {
+      const auto c = hex[i];
+      value <<= 4u;
+      if ('0' <= c && c <= '9') {
+        value |= static_cast<std::uint32_t>(c - '0');
+      } else if ('A' <= c && c <= 'F') {
+        value |= static_cast<std::uint32_t>(c - 'A' + 10);
+      } else if ('a' <= c && c <= 'f') {
+        value |= static_cast<std::uint32_t>(c - 'a' + 10);
+      } else {
+        assert(false && "illegal character");
+      }
+    }
+    hex.remove_prefix(4);
+    return value;
+  };
+
+  const auto codepoint = readHex(sv);
+
+  if (0xDC00u <= codepoint && codepoint <= 0xDFFFu) {
+    assert(false && "unpaired low surrogate");
+    return replacement;
+  } else if (codepoint < 0xD800u || 0xDBFFu < codepoint) {
+    return codepoint;
+  }
+
+  // a high surrogate has to be followed by \\u and a low surrogate
+  if (std::size(sv) >= 2 && sv[0] == '\\' && sv[1] == 'u') {
+    auto next = sv.substr(2);
+    const auto low = readHex(next);
+    if (0xDC00u <= low && low <= 0xDFFFu) {
+      sv = next;
+      return 0x10000u + ((codepoint - 0xD800u) << 10u) + (low - 0xDC00u);
+    }
+  }
+  assert(false && "unpaired high surrogate");
+  return replacement;
+}
+
+// encodes codepoint as utf-8
+template<class CharT, class Traits>
+constexpr void append_codepoint(std::basic_string<CharT, Traits>& result, std::uint32_t codepoint) {
+  if (codepoint < 0x80) {
+    // 1-byte characters: 0xxxxxxx (ASCII)
+    result.push_back(static_cast<CharT>(codepoint));
+  } else if (codepoint <= 0x7FF) {
+    // 2-byte characters: 110xxxxx 10xxxxxx
+    result.push_back(static_cast<CharT>(0xC0u | (codepoint >> 6u)));
+    result.push_back(static_cast<CharT>(0x80u | (codepoint & 0x3Fu)));
+  } else if (codepoint <= 0xFFFF) {
+    // 3-byte characters: 1110xxxx 10xxxxxx 10xxxxxx
+    result.push_back(static_cast<CharT>(0xE0u | (codepoint >> 12u)));
+    result.push_back(static_cast<CharT>(0x80u | ((codepoint >> 6u) & 0x3Fu)));
+    result.push_back(static_cast<CharT>(0x80u | (codepoint & 0x3Fu)));
+  } else {
+    // 4-byte characters: 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
+    result.push_back(static_cast<CharT>(0xF0u | (codepoint >> 18u)));
+    result.push_back(static_cast<CharT>(0x80u | ((codepoint >> 12u) & 0x3Fu)));
+    result.push_back(static_cast<CharT>(0x80u | ((codepoint >> 6u) & 0x3Fu)));
+    result.push_back(static_cast<CharT>(0x80u | (codepoint & 0x3Fu)));
+  }
+}
+
+template<class CharT, class Traits>
+constexpr std::basic_string_view<CharT, Traits> read_string_impl(std::basic_string_view<CharT, Traits> sv) {
   while (!sv.empty()) {
+    const auto run = sv.substr(0, find_string_special(sv));
+    check_run(run);
+    sv.remove_prefix(std::size(run));
+
+    if (sv.empty()) {
+      continue;
+    }
+
     switch (sv.front()) {
-      case '\x00':
-      case '\x01':
-      case '\x02':
-      case '\x03':
-      case '\x04':
-      case '\x05':
-      case '\x06':
-      case '\x07':
-      case '\x08':
-      case '\x09':
-      case '\x0A':
-      case '\x0B':
-      case '\x0C':
-      case '\x0D':
-      case '\x0E':
-      case '\x0F':
-      case '\x10':
-      case '\x11':
-      case '\x12':
-      case '\x13':
-      case '\x14':
-      case '\x15':
-      case '\x16':
-      case '\x17':
-      case '\x18':
-      case '\x19':
-      case '\x1A':
-      case '\x1B':
-      case '\x1C':
-      case '\x1D':
-      case '\x1E':
-      case '\x1F':
-        assert(false && "illegal character");
-        break;
       case '\"':
         return sv;
       case '\\':
         sv.remove_prefix(1);
         assert(!sv.empty());
 
-        switch (sv.front()) {
+        switch (sv.empty() ? CharT() : sv.front()) {
           case '\"':
           case '\\':
           case '/':
@@ -157,20 +297,19 @@ constexpr std::basic_string_view<CharT, Traits> read_string_impl(std::basic_stri
           case 'n':
           case 'r':
           case 't':
+            sv.remove_prefix(1);
             break;
           case 'u':
-            assert(std::size(sv) >= 4);
-            for (int i = 0; i < 4; ++i) {
-              assert(isHex(sv[1 + i]));
-            }
-            sv.remove_prefix(4);
+            sv.remove_prefix(1);
+            read_codepoint(sv);
             break;
           default:
             assert(false && "illegal character");
             break;
         }
-        [[fallthrough]];
-      default:
+        break;
+      default: // control character
+        assert(false && "illegal character");
         sv.remove_prefix(1);
         break;
     }
@@ -180,6 +319,336 @@ constexpr std::basic_string_view<CharT, Traits> read_string_impl(std::basic_stri
 }
 } // namespace detail
 
+/*---------------------------- validating scanner ----------------------------*/
+
+enum struct scan_error {
+  none,
+  unexpected_end,       // the input ends inside of a value
+  unexpected_character, // e.g. a missing ',', ':' or closing bracket, or an unknown literal
+  invalid_string,       // a control character, an invalid escape sequence or (JFLECT_VALIDATE_UTF8) invalid utf-8
+  invalid_number,
+  too_deep // more nested arrays and objects than the maximum depth
+};
+
+struct scan_result {
+  std::size_t pos; // past the value, or where the error was found
+  scan_error error;
+
+  constexpr explicit operator bool() const noexcept { return error == scan_error::none; }
+};
+
+namespace detail {
+
+// the kind of token which starts with a character
+enum struct token : std::uint8_t {
+  invalid,
+  whitespace,
+  object_begin,
+  object_end,
+  array_begin,
+  array_end,
+  string,
+  number,
+  literal_true,
+  literal_false,
+  literal_null,
+  comma,
+  colon
+};
+
+inline constexpr auto tokens = [] {
+  std::array<token, 256> table{};
+  const auto set = [&table](char c, token t) { table[static_cast<unsigned char>(c)] = t; };
+
+  for (const auto c : {' ', '\n', '\r', '\t'}) {
+    set(c, token::whitespace);
+  }
+  for (const auto c : {'-', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9'}) {
+    set(c, token::number);
+  }
+  set('{', token::object_begin);
+  set('}', token::object_end);
+  set('[', token::array_begin);
+  set(']', token::array_end);
+  set('"', token::string);
+  set('t', token::literal_true);
+  set('f', token::literal_false);
+  set('n', token::literal_null);
+  set(',', token::comma);
+  set(':', token::colon);
+  return table;
+}();
+
+template<class CharT>
+constexpr token token_of(CharT c) noexcept {
+  const auto u = static_cast<std::make_unsigned_t<CharT>>(c);
+  if constexpr (sizeof(CharT) == 1) {
+    return tokens[u];
+  } else {
+    return u < std::size(tokens) ? tokens[u] : token::invalid;
+  }
+}
+
+// the position of the first character which is not whitespace, indentation is skipped a simd::block at a time
+template<class CharT, class Traits>
+constexpr std::size_t skip_whitespace(std::basic_string_view<CharT, Traits> sv, std::size_t pos) noexcept {
+  const auto isSpace = [](CharT c) { return token_of(c) == token::whitespace; };
+
+  if (pos == std::size(sv) || !isSpace(sv[pos])) { // minified json
+    return pos;
+  }
+
+  if constexpr (std::same_as<CharT, char>) {
+    constexpr auto all = (simd::mask{1} << simd::block_size) - 1;
+    const auto first = std::data(sv) + pos;
+    const auto match = simd::find_if(
+        first,
+        std::data(sv) + std::size(sv),
+        [](const simd::block& b) { return ~b.any_of(' ', '\n', '\r', '\t') & all; },
+        std::not_fn(isSpace));
+    return pos + static_cast<std::size_t>(match - first);
+  } else {
+    while (pos < std::size(sv) && isSpace(sv[pos])) {
+      ++pos;
+    }
+    return pos;
+  }
+}
+
+// validates a json-string from past its opening ", the result is past the closing "
+template<bool ValidateUtf8, class CharT, class Traits>
+constexpr scan_result scan_string(std::basic_string_view<CharT, Traits> sv, std::size_t pos) noexcept {
+  const auto isHex = [](CharT c) {
+    return ('0' <= c && c <= '9') || ('a' <= c && c <= 'f') || ('A' <= c && c <= 'F');
+  };
+
+  while (pos < std::size(sv)) {
+    const auto runSize = find_string_special(sv.substr(pos));
+    if constexpr (ValidateUtf8 && std::same_as<CharT, char>) {
+      if (!utf8::is_valid(sv.substr(pos, runSize))) {
+        return {pos, scan_error::invalid_string};
+      }
+    }
+    pos += runSize;
+
+    if (pos == std::size(sv)) {
+      continue;
+    }
+    if (sv[pos] == '"') {
+      return {pos + 1, scan_error::none};
+    }
+    if (sv[pos] != '\\') {
+      return {pos, scan_error::invalid_string}; // control character
+    }
+    if (pos + 1 == std::size(sv)) {
+      return {std::size(sv), scan_error::unexpected_end};
+    }
+
+    switch (sv[pos + 1]) {
+      case '"':
+      case '\\':
+      case '/':
+      case 'b':
+      case 'f':
+      case 'n':
+      case 'r':
+      case 't':
+        pos += 2;
+        break;
+      case 'u':
+        if (pos + 6 > std::size(sv)) {
+          return {std::size(sv), scan_error::unexpected_end};
+        }
+        if (!std::all_of(std::begin(sv) + pos + 2, std::begin(sv) + pos + 6, isHex)) {
+          return {pos, scan_error::invalid_string};
+        }
+        pos += 6;
+        break;
+      default:
+        return {pos, scan_error::invalid_string};
+    }
+  }
+  return {std::size(sv), scan_error::unexpected_end};
+}
+
+// -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+template<class CharT, class Traits>
+constexpr scan_result scan_number(std::basic_string_view<CharT, Traits> sv, std::size_t pos) noexcept {
+  const auto isDigit = [&sv](std::size_t i) { return i < std::size(sv) && '0' <= sv[i] && sv[i] <= '9'; };
+  const auto digits = [&](std::size_t& i) {
+    const auto begin = i;
+    while (isDigit(i)) {
+      ++i;
+    }
+    return i != begin;
+  };
+
+  if (sv[pos] == '-') {
+    ++pos;
+  }
+  if (pos < std::size(sv) && sv[pos] == '0') {
+    ++pos;
+  } else if (!digits(pos)) {
+    return {pos, pos == std::size(sv) ? scan_error::unexpected_end : scan_error::invalid_number};
+  }
+
+  if (pos < std::size(sv) && sv[pos] == '.') {
+    ++pos;
+    if (!digits(pos)) {
+      return {pos, pos == std::size(sv) ? scan_error::unexpected_end : scan_error::invalid_number};
+    }
+  }
+
+  if (pos < std::size(sv) && (sv[pos] == 'e' || sv[pos] == 'E')) {
+    ++pos;
+    if (pos < std::size(sv) && (sv[pos] == '+' || sv[pos] == '-')) {
+      ++pos;
+    }
+    if (!digits(pos)) {
+      return {pos, pos == std::size(sv) ? scan_error::unexpected_end : scan_error::invalid_number};
+    }
+  }
+
+  return {pos, scan_error::none};
+}
+
+template<class CharT, class Traits>
+constexpr scan_result scan_literal(std::basic_string_view<CharT, Traits> sv,
+                                   std::size_t pos,
+                                   std::string_view literal) noexcept {
+  std::size_t i = 0;
+  while (i < std::size(literal) && pos + i < std::size(sv) && sv[pos + i] == static_cast<CharT>(literal[i])) {
+    ++i;
+  }
+  if (i == std::size(literal)) {
+    return {pos + i, scan_error::none};
+  }
+  return {pos, pos + i == std::size(sv) ? scan_error::unexpected_end : scan_error::unexpected_character};
+}
+
+} // namespace detail
+
+#ifndef JFLECT_MAX_DEPTH
+#define JFLECT_MAX_DEPTH 1024
+#endif
+
+/**
+ * @brief validates a json-value without recursion
+ *
+ * The nesting is tracked on an explicit stack of one bit per level (array or object), so the stack use is bounded for
+ * any input. Every token is dispatched on its first character through a table of 256 entries.
+ *
+ * @tparam MaxDepth the maximum number of nested arrays and objects, JFLECT_MAX_DEPTH (1024) by default
+ * @tparam ValidateUtf8 whether the content of strings has to be well-formed utf-8, JFLECT_VALIDATE_UTF8 by default
+ * @param sv a view from the begining of a json-value (leading whitespace is skipped) to its end (or beyond)
+ * @return the position past the value or of the first error
+ */
+template<std::size_t MaxDepth = JFLECT_MAX_DEPTH,
+         bool ValidateUtf8 = JFLECT_VALIDATE_UTF8 != 0,
+         class CharT,
+         class Traits>
+constexpr scan_result scan_value(std::basic_string_view<CharT, Traits> sv) noexcept {
+  using detail::token;
+
+  enum struct expect { value, first_value, key, first_key, colon, next };
+
+  std::array<std::uint64_t, (MaxDepth + 63) / 64> isObject{}; // a bit per level
+  const auto top = [&isObject](std::size_t depth) {
+    return ((isObject[(depth - 1) / 64] >> ((depth - 1) % 64)) & 1u) != 0;
+  };
+
+  std::size_t depth = 0;
+  std::size_t pos = 0;
+  auto expected = expect::value;
+
+  while (!(expected == expect::next && depth == 0)) {
+    pos = detail::skip_whitespace(sv, pos);
+    if (pos == std::size(sv)) {
+      return {pos, scan_error::unexpected_end};
+    }
+
+    const auto t = detail::token_of(sv[pos]);
+    auto result = scan_result{pos + 1, scan_error::none};
+
+    switch (expected) {
+      case expect::first_value:
+      case expect::value:
+        if (expected == expect::first_value && t == token::array_end) {
+          --depth;
+          expected = expect::next;
+          break;
+        }
+        expected = expect::next;
+        switch (t) {
+          case token::object_begin:
+          case token::array_begin: {
+            if (depth == MaxDepth) {
+              return {pos, scan_error::too_deep};
+            }
+            auto& word = isObject[depth / 64];
+            const auto bit = std::uint64_t{1} << (depth % 64);
+            word = t == token::object_begin ? word | bit : word & ~bit;
+            ++depth;
+            expected = t == token::object_begin ? expect::first_key : expect::first_value;
+            break;
+          }
+          case token::string:
+            result = detail::scan_string<ValidateUtf8>(sv, pos + 1);
+            break;
+          case token::number:
+            result = detail::scan_number(sv, pos);
+            break;
+          case token::literal_true:
+            result = detail::scan_literal(sv, pos, "true");
+            break;
+          case token::literal_false:
+            result = detail::scan_literal(sv, pos, "false");
+            break;
+          case token::literal_null:
+            result = detail::scan_literal(sv, pos, "null");
+            break;
+          default:
+            return {pos, scan_error::unexpected_character};
+        }
+        break;
+      case expect::first_key:
+      case expect::key:
+        if (expected == expect::first_key && t == token::object_end) {
+          --depth;
+          expected = expect::next;
+        } else if (t == token::string) {
+          result = detail::scan_string<ValidateUtf8>(sv, pos + 1);
+          expected = expect::colon;
+        } else {
+          return {pos, scan_error::unexpected_character};
+        }
+        break;
+      case expect::colon:
+        if (t != token::colon) {
+          return {pos, scan_error::unexpected_character};
+        }
+        expected = expect::value;
+        break;
+      case expect::next:
+        if (t == token::comma) {
+          expected = top(depth) ? expect::key : expect::value;
+        } else if (t == (top(depth) ? token::object_end : token::array_end)) {
+          --depth;
+        } else {
+          return {pos, scan_error::unexpected_character};
+        }
+        break;
+    }
+
+    if (!result) {
+      return result;
+    }
+    pos = result.pos;
+  }
+
+  return {pos, scan_error::none};
+}
+
 template<class CharT, class Traits>
 constexpr std::basic_string_view<CharT, Traits> read_string(std::basic_string_view<CharT, Traits> sv) {
   trim_read(sv, '"');
@@ -190,196 +659,220 @@ constexpr std::basic_string_view<CharT, Traits> read_string(std::basic_string_vi
 
 template<class CharT, class Traits>
 constexpr std::basic_string_view<CharT, Traits> read_array(std::basic_string_view<CharT, Traits> sv) {
-  trim_read_trim(sv, '[');
+  trim(sv);
+  assert(sv.starts_with('['));
+  return read_value(sv);
+}
 
-  if (sv.starts_with(']')) { // empty array
-    sv.remove_prefix(1);
-    return sv;
-  }
+template<class CharT, class Traits>
+constexpr std::basic_string_view<CharT, Traits> read_object(std::basic_string_view<CharT, Traits> sv) {
+  trim(sv);
+  assert(sv.starts_with('{'));
+  return read_value(sv);
+}
 
-  for (;;) {
-    sv = read_value(sv);
+/**
+ * @brief reads a json-value
+ *
+ * @param sv a view from the begining of a json-value to its end (or beyond)
+ * @return a std::string_view past the value
+ */
+template<class CharT, class Traits>
+constexpr std::basic_string_view<CharT, Traits> read_value(std::basic_string_view<CharT, Traits> sv) {
+  const auto result = scan_value(sv);
+  assert(result && "invalid json-value");
+  return sv.substr(result.pos);
+}
 
-    trim(sv);
-    if (!optional_read(sv, ','))
-      break;
-    ;
-  }
+/*-------------------------- non-validating skipping --------------------------*/
 
-  trim_read(sv, ']');
-  return sv;
+namespace detail {
+// the position of the first of the given characters or the size of sv
+template<class CharT, class Traits, class... Chars>
+constexpr std::size_t find_any(std::basic_string_view<CharT, Traits> sv, Chars... cs) noexcept {
+  const auto isAny = [=](CharT c) { return ((c == cs) || ...); };
+
+  if constexpr (std::same_as<CharT, char>) {
+    const auto first = std::data(sv);
+    const auto match = simd::find_if(
+        first, first + std::size(sv), [=](const simd::block& b) { return b.any_of(cs...); }, isAny);
+    return static_cast<std::size_t>(match - first);
+  } else {
+    return static_cast<std::size_t>(std::find_if(std::begin(sv), std::end(sv), isAny) - std::begin(sv));
+  }
 }
 
 template<class CharT, class Traits>
-constexpr std::basic_string_view<CharT, Traits> read_object(std::basic_string_view<CharT, Traits> sv) {
-  trim_read_trim(sv, '{');
+constexpr std::basic_string_view<CharT, Traits> skip_container(std::basic_string_view<CharT, Traits> sv) noexcept;
+} // namespace detail
 
-  if (sv.starts_with('}')) // empty object
-  {
-    sv.remove_prefix(1);
-    return sv;
-  }
+/**
+ * @brief skips a json-string without validating its content
+ *
+ * @param sv a view from the begining of a json-string to its end (or beyond)
+ * @return a std::string_view past the closing "
+ */
+template<class CharT, class Traits>
+constexpr std::basic_string_view<CharT, Traits> skip_string(std::basic_string_view<CharT, Traits> sv) noexcept {
+  trim_read(sv, '"');
 
   for (;;) {
-    sv = read_string(sv);
-    trim_read(sv, ':');
-    sv = read_value(sv);
-    trim(sv);
-    if (!optional_read(sv, ','))
-      break;
-  }
+    sv.remove_prefix(detail::find_any(sv, '"', '\\'));
 
-  trim_read(sv, '}');
-  return sv;
+    if (sv.empty()) {
+      assert(false && "missing \" character");
+      return sv;
+    }
+
+    if (sv.front() == '"') {
+      sv.remove_prefix(1);
+      return sv;
+    }
+
+    // skip the escaped character
+    sv.remove_prefix(std::min<std::size_t>(2, std::size(sv)));
+  }
 }
 
 /**
- * @brief reads a json-value
+ * @brief skips a json-value without validating it
+ *
+ * Only string boundaries and the nesting depth of arrays and objects are tracked, which makes this considerably
+ * cheaper than read_value for values which are not used.
  *
  * @param sv a view from the begining of a json-value to its end (or beyond)
  * @return a std::string_view past the value
  */
 template<class CharT, class Traits>
-constexpr std::basic_string_view<CharT, Traits> read_value(std::basic_string_view<CharT, Traits> sv) {
-  // clang-format off
+constexpr std::basic_string_view<CharT, Traits> skip_value(std::basic_string_view<CharT, Traits> sv) noexcept {
   trim(sv);
   assert(!sv.empty());
-  if (sv.starts_with('{')) return read_object(sv);
-  if (sv.starts_with('[')) return read_array(sv);
-  if (sv.starts_with('"')) return read_string(sv);
-  return read_other(sv);
-  // clang-format on
+
+  switch (sv.front()) {
+    case '"':
+      return skip_string(sv);
+    case '[':
+    case '{':
+      return detail::skip_container(sv);
+    default: // number, true, false or null
+      sv.remove_prefix(detail::find_any(sv, ',', ']', '}', ' ', '\n', '\r', '\t'));
+      return sv;
+  }
 }
 
+namespace detail {
 template<class CharT, class Traits>
-std::pair<std::basic_string<CharT, Traits>, std::basic_string_view<CharT, Traits>> parse_string(
-    std::basic_string_view<CharT, Traits> sv) {
-  std::basic_string<CharT, Traits> result;
+constexpr std::basic_string_view<CharT, Traits> skip_container(std::basic_string_view<CharT, Traits> sv) noexcept {
+  std::size_t depth = 0;
 
-  auto begin = std::begin(sv);
-  const auto end = std::end(sv);
+  for (;;) {
+    sv.remove_prefix(find_any(sv, '"', '[', ']', '{', '}'));
 
-  const auto readUnicode = [&]() {
-    int32_t codepoint = 0;
+    if (sv.empty()) {
+      assert(false && "unterminated array or object");
+      return sv;
+    }
 
-    for (const auto factor : {12u, 8u, 4u, 0u}) {
-      ++begin;
-      assert(begin != end);
+    switch (sv.front()) {
+      case '"':
+        sv = skip_string(sv);
+        break;
+      case '[':
+      case '{':
+        ++depth;
+        sv.remove_prefix(1);
+        break;
+      default:
+        sv.remove_prefix(1);
+        if (--depth == 0)
+          return sv;
+        break;
+    }
+  }
+}
+} // namespace detail
 
-      if ('0' <= *begin && *begin <= '9') {
-        codepoint += static_cast<int32_t>((static_cast<uint32_t>(*begin) - 0x30u) << factor);
-      } else if ('A' <= *begin && *begin <= 'F') {
-        codepoint += static_cast<int32_t>((static_cast<uint32_t>(*begin) - 0x37u) << factor);
-      } else if ('a' <= *begin && *begin <= 'f') {
-        codepoint += static_cast<int32_t>((static_cast<uint32_t>(*begin) - 0x57u) << factor);
-      } else {
-        assert(false);
-      }
+/*----------------------------------------------------------------------------*/
+
+/**
+ * @brief decodes the content of a json-string and appends it to result
+ *
+ * The runs between escape sequences are found a simd::block at a time and appended at once.
+ *
+ * @param sv a view past the opening " of a json-string
+ * @return a std::string_view past the closing " of the json-string
+ */
+template<class CharT, class Traits>
+constexpr std::basic_string_view<CharT, Traits> parse_string_append(std::basic_string_view<CharT, Traits> sv,
+                                                                    std::basic_string<CharT, Traits>& result) {
+  while (!sv.empty()) {
+    const auto run = sv.substr(0, detail::find_string_special(sv));
+    detail::check_run(run);
+    result.append(run);
+    sv.remove_prefix(std::size(run));
+
+    if (sv.empty()) {
+      continue;
     }
 
-    // translate codepoint into bytes
-    if (codepoint < 0x80) {
-      // 1-byte characters: 0xxxxxxx (ASCII)
-      result.push_back(static_cast<char>(codepoint));
-    } else if (codepoint <= 0x7FF) {
-      // 2-byte characters: 110xxxxx 10xxxxxx
-      result.push_back(static_cast<char>(0xC0u | (static_cast<uint32_t>(codepoint) >> 6u)));
-      result.push_back(static_cast<char>(0x80u | (static_cast<uint32_t>(codepoint) & 0x3Fu)));
-    } else if (codepoint <= 0xFFFF) {
-      // 3-byte characters: 1110xxxx 10xxxxxx 10xxxxxx
-      result.push_back(static_cast<char>(0xE0u | (static_cast<uint32_t>(codepoint) >> 12u)));
-      result.push_back(static_cast<char>(0x80u | ((static_cast<uint32_t>(codepoint) >> 6u) & 0x3Fu)));
-      result.push_back(static_cast<char>(0x80u | (static_cast<uint32_t>(codepoint) & 0x3Fu)));
-    } else {
-      // 4-byte characters: 11110xxx 10xxxxxx 10xxxxxx 10xxxxxx
-      result.push_back(static_cast<char>(0xF0u | (static_cast<uint32_t>(codepoint) >> 18u)));
-      result.push_back(static_cast<char>(0x80u | ((static_cast<uint32_t>(codepoint) >> 12u) & 0x3Fu)));
-      result.push_back(static_cast<char>(0x80u | ((static_cast<uint32_t>(codepoint) >> 6u) & 0x3Fu)));
-      result.push_back(static_cast<char>(0x80u | (static_cast<uint32_t>(codepoint) & 0x3Fu)));
+    const auto c = sv.front();
+    sv.remove_prefix(1);
+
+    if (c == '\"') {
+      return sv;
+    } else if (c != '\\') {
+      assert(false && "illegal character");
+      continue;
+    } else if (sv.empty()) {
+      continue;
     }
-  };
 
-  for (; begin != end; ++begin) {
-    switch (*begin) {
-      case '\x00':
-      case '\x01':
-      case '\x02':
-      case '\x03':
-      case '\x04':
-      case '\x05':
-      case '\x06':
-      case '\x07':
-      case '\x08':
-      case '\x09':
-      case '\x0A':
-      case '\x0B':
-      case '\x0C':
-      case '\x0D':
-      case '\x0E':
-      case '\x0F':
-      case '\x10':
-      case '\x11':
-      case '\x12':
-      case '\x13':
-      case '\x14':
-      case '\x15':
-      case '\x16':
-      case '\x17':
-      case '\x18':
-      case '\x19':
-      case '\x1A':
-      case '\x1B':
-      case '\x1C':
-      case '\x1D':
-      case '\x1E':
-      case '\x1F':
-        assert(false && "illegal character");
-        break;
+    const auto escaped = sv.front();
+    sv.remove_prefix(1);
+
+    switch (escaped) {
       case '\"':
-        return {result, {++begin, end}};
+        result.push_back('\"');
+        break;
       case '\\':
-        ++begin;
-        assert(begin != end);
-        switch (*begin) {
-          case '\"':
-            result.push_back('\"');
-            break;
-          case '\\':
-            result.push_back('\\');
-            break;
-          case '/':
-            result.push_back('/');
-            break;
-          case 'b':
-            result.push_back('\b');
-            break;
-          case 'f':
-            result.push_back('\f');
-            break;
-          case 'n':
-            result.push_back('\n');
-            break;
-          case 'r':
-            result.push_back('\r');
-            break;
-          case 't':
-            result.push_back('\t');
-            break;
-          case 'u':
-            readUnicode();
-            break;
-          default:
-            assert(false && "Unexspected character");
-            break;
-        }
+        result.push_back('\\');
+        break;
+      case '/':
+        result.push_back('/');
+        break;
+      case 'b':
+        result.push_back('\b');
+        break;
+      case 'f':
+        result.push_back('\f');
+        break;
+      case 'n':
+        result.push_back('\n');
+        break;
+      case 'r':
+        result.push_back('\r');
+        break;
+      case 't':
+        result.push_back('\t');
+        break;
+      case 'u':
+        detail::append_codepoint(result, detail::read_codepoint(sv));
         break;
       default:
-        result.push_back(*begin);
+        assert(false && "Unexspected character");
         break;
     }
   }
   assert(false && "missing \" character");
-  return {{}, {}};
+  return {};
+}
+
+template<class CharT, class Traits>
+constexpr std::pair<std::basic_string<CharT, Traits>, std::basic_string_view<CharT, Traits>> parse_string(
+    std::basic_string_view<CharT, Traits> sv) {
+  std::basic_string<CharT, Traits> result;
+  const auto rest = parse_string_append(sv, result);
+  return {std::move(result), rest};
 }
 
 } // namespace jflect::parser
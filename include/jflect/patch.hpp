@@ -0,0 +1,294 @@
+#ifndef JFLECT_PATCH_HPP_
+#define JFLECT_PATCH_HPP_
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#include "concepts.hpp"
+#include "jflect.hpp"
+#include "meta.hpp"
+#include "options.hpp"
+#include "parser.hpp"
+#include "traits.hpp"
+
+/**
+ * JSON merge patches (RFC 7386) between two values of the same type.
+ *
+ * write_diff(prev, curr) writes only the members of structs and the entries of maps which differ, nested structs and
+ * maps are patched recursively. Everything else (arrays, strings, numbers, ...) is replaced as a whole, an optional
+ * which became empty and a removed map entry are written as null. apply_patch(sv, prev) turns prev into curr.
+ *
+ * A null can not tell both apart (RFC 7386), so the entry of a map of optionals whose value became empty is erased by
+ * apply_patch instead of keeping an empty optional: the keys of such maps do not round trip.
+ *
+ * update_to(sv, value) reads partial updates with the same rules into a long-lived value, but merges arrays element by
+ * element and keeps the storage of strings and arrays.
+ *
+ * Values are compared element by element, structs without an operator== member by member.
+ */
+namespace jflect {
+
+namespace patch_helper {
+
+using struct_helper::equal;
+using struct_helper::for_each_member;
+using struct_helper::members;
+using struct_helper::object_struct;
+
+// a patch of these only holds the changes
+template<class T>
+concept mergeable = object_struct<std::remove_cvref_t<T>> || cpt::map_like<std::remove_cvref_t<T>>;
+
+template<mergeable T>
+constexpr void write_diff(std::output_iterator<const char&> auto out, const T& prev, const T& curr);
+
+// writes the new value of something which is not equal
+template<class T>
+constexpr void write_change(std::output_iterator<const char&> auto out, const T& prev, const T& curr) {
+  if constexpr (mergeable<T>) {
+    write_diff(out, prev, curr);
+  } else if constexpr (detail::is_specialization_of_v<T, std::optional>) {
+    if (!curr.has_value()) {
+      detail::write_chars(out, "null");
+    } else if constexpr (mergeable<typename T::value_type>) {
+      prev.has_value() ? write_diff(out, *prev, *curr) : write_to(out, *curr);
+    } else {
+      write_to(out, *curr);
+    }
+  } else {
+    write_to(out, curr);
+  }
+}
+
+template<mergeable T>
+constexpr void write_diff(std::output_iterator<const char&> auto out, const T& prev, const T& curr) {
+  out = '{';
+  bool first = true;
+
+  const auto key = [&](const auto& name) {
+    if (!first) {
+      out = ',';
+    }
+    write_to(out, name);
+    out = ':';
+    first = false;
+  };
+
+  if constexpr (object_struct<T>) {
+    for_each_member<T>([&](auto i) {
+      constexpr auto pointer = std::get<i>(members<T>::pointers);
+      if (!equal(prev.*pointer, curr.*pointer)) {
+        key(members<T>::names[i]);
+        write_change(out, prev.*pointer, curr.*pointer);
+      }
+    });
+  } else {
+    for (const auto& [name, mapped] : prev) {
+      if (curr.find(name) == std::end(curr)) {
+        key(name);
+        detail::write_chars(out, "null"); // removed
+      }
+    }
+    for (const auto& [name, mapped] : curr) {
+      const auto search = prev.find(name);
+      if (search == std::end(prev)) {
+        key(name);
+        write_to(out, mapped);
+      } else if (!equal(search->second, mapped)) {
+        key(name);
+        write_change(out, search->second, mapped);
+      }
+    }
+  }
+
+  out = '}';
+}
+
+enum struct mode {
+  patch, // arrays are replaced
+  update // arrays are updated element by element
+};
+
+// arrays which are updated in place, their elements are changed, appended and removed at the back; sets (and other
+// ranges of const elements) are read as a whole
+template<class T>
+concept updatable_range = (cpt::range_like<T> || (cpt::tuple_like<T> && std::ranges::range<T>)) &&
+                          !cpt::string_like<T> && !cpt::map_like<T> &&
+                          std::is_lvalue_reference_v<std::ranges::range_reference_t<T>> &&
+                          !std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<T>>>;
+
+template<mode M, mergeable T>
+constexpr auto merge_object(std::string_view sv, T& value) -> decltype(std::begin(sv));
+
+template<class T>
+constexpr auto update_range(std::string_view sv, T& value) -> decltype(std::begin(sv));
+
+// applies the new value of a member, map entry or array element
+template<mode M, class T>
+constexpr auto apply_change(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  if constexpr (mergeable<T>) {
+    return merge_object<M>(sv, value);
+  } else if constexpr (detail::is_specialization_of_v<T, std::optional>) {
+    if (value.has_value() && parser::peek_type(sv) != parser::value_type::null) {
+      return apply_change<M>(sv, *value);
+    }
+    return read_to(sv, value);
+  } else if constexpr (std::same_as<T, std::string>) {
+    parser::trim_read(sv, '"');
+    value.clear(); // keeps the capacity
+    return std::begin(parser::parse_string_append(sv, value));
+  } else if constexpr (M == mode::update && updatable_range<T>) {
+    return update_range(sv, value);
+  } else {
+    return read_to(sv, value);
+  }
+}
+
+template<mode M, mergeable T>
+constexpr auto merge_object(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  parser::trim_read(sv, '{');
+  parser::trim(sv);
+
+  while (!sv.starts_with('}')) {
+    if constexpr (object_struct<T>) {
+      parser::trim_read(sv, '"');
+      const auto endQuotePos = sv.find('"');
+      assert(endQuotePos != std::string_view::npos);
+      const auto name = sv.substr(0, endQuotePos);
+      sv.remove_prefix(endQuotePos + 1);
+      parser::trim_read(sv, ':');
+
+      bool found = false;
+      for_each_member<T>([&](auto i) {
+        if (!found && members<T>::names[i] == name) {
+          sv = std::string_view(apply_change<M>(sv, value.*std::get<i>(members<T>::pointers)), std::end(sv));
+          found = true;
+        }
+      });
+      if (!found) {
+        sv = parser::skip_value(sv);
+      }
+    } else {
+      using key_type = typename T::key_type;
+      using mapped_type = typename T::mapped_type;
+
+      key_type name;
+      sv = std::string_view(read_to(sv, name), std::end(sv));
+      parser::trim_read(sv, ':');
+      parser::trim(sv);
+
+      const auto search = value.find(name);
+      if (sv.starts_with("null")) {
+        sv.remove_prefix(4);
+        if (search != std::end(value)) {
+          value.erase(search);
+        }
+      } else if (search == std::end(value)) {
+        mapped_type mapped{};
+        sv = std::string_view(read_to(sv, mapped), std::end(sv));
+        value.emplace(std::move(name), std::move(mapped));
+      } else {
+        sv = std::string_view(apply_change<M>(sv, search->second), std::end(sv));
+      }
+    }
+
+    parser::trim(sv);
+    if (!parser::optional_read(sv, ',')) {
+      break;
+    }
+    parser::trim(sv);
+    assert(!sv.starts_with('}') && "trailing comma");
+  }
+
+  parser::read(sv, '}');
+  return std::begin(sv);
+}
+
+template<class T>
+constexpr auto update_range(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  parser::trim_read(sv, '[');
+  parser::trim(sv);
+
+  auto iter = std::begin(value);
+  std::size_t count = 0;
+
+  while (!sv.starts_with(']')) {
+    if (iter != std::end(value)) {
+      sv = std::string_view(apply_change<mode::update>(sv, *iter), std::end(sv));
+      ++iter;
+    } else if constexpr (requires { value.emplace_back(); }) {
+      sv = std::string_view(read_to(sv, value.emplace_back()), std::end(sv));
+      iter = std::end(value);
+    } else {
+      assert(false && "too many elements for a fixed size array");
+    }
+    ++count;
+
+    parser::trim(sv);
+    if (!parser::optional_read(sv, ',')) {
+      break;
+    }
+    parser::trim(sv);
+    assert(!sv.starts_with(']') && "trailing comma");
+  }
+
+  if constexpr (requires { value.pop_back(); }) {
+    while (std::size(value) > count) {
+      value.pop_back();
+    }
+  } else {
+    assert(count == std::size(value) && "too few elements for a fixed size array");
+  }
+
+  parser::read(sv, ']');
+  return std::begin(sv);
+}
+
+} // namespace patch_helper
+
+/**
+ * @brief writes a merge patch which turns prev into curr, {} if they are equal
+ */
+template<patch_helper::mergeable T>
+constexpr void write_diff_to(std::output_iterator<const char&> auto out, const T& prev, const T& curr) {
+  patch_helper::write_diff(out, prev, curr);
+}
+
+template<patch_helper::mergeable T>
+CONSTEXPR_20_STRING std::string write_diff(const T& prev, const T& curr) {
+  std::string str;
+  write_diff_to(detail::string_appender(str), prev, curr);
+  return str;
+}
+
+/**
+ * @brief merges a patch of write_diff into value, members and entries which are not in the patch are left as they are
+ */
+template<patch_helper::mergeable T>
+constexpr auto apply_patch(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  return patch_helper::merge_object<patch_helper::mode::patch>(sv, value);
+}
+
+/**
+ * @brief reads a partial update into an existing value
+ *
+ * Like apply_patch, but arrays are updated element by element, so objects in arrays are merged as well. Strings and
+ * arrays keep their storage, elements are only appended or removed at the back.
+ */
+template<class T>
+constexpr auto update_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  return patch_helper::apply_change<patch_helper::mode::update>(sv, value);
+}
+
+} // namespace jflect
+#endif // JFLECT_PATCH_HPP_
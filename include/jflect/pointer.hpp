@@ -0,0 +1,185 @@
+#ifndef JFLECT_POINTER_HPP_
+#define JFLECT_POINTER_HPP_
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "document.hpp"
+#include "helper.hpp"
+
+namespace jflect {
+
+namespace pointer_helper {
+
+struct token {
+  std::size_t offset; // offset into the unescaped buffer
+  std::size_t size;
+  std::optional<std::size_t> index; // set if the token is a valid array index
+};
+
+// "0", "17" are array indices, "017", "-1", "" are not
+constexpr std::optional<std::size_t> as_index(std::string_view sv) noexcept {
+  if (sv.empty() || (sv.size() > 1 && sv.front() == '0'))
+    return std::nullopt;
+
+  std::size_t index = 0;
+  for (const auto c : sv) {
+    if (c < '0' || '9' < c)
+      return std::nullopt;
+    index = index * 10 + static_cast<std::size_t>(c - '0');
+  }
+  return index;
+}
+
+// replaces ~1 with / and ~0 with ~
+template<class OutputIt>
+constexpr OutputIt unescape(std::string_view sv, OutputIt out) {
+  for (auto iter = std::begin(sv); iter != std::end(sv); ++iter) {
+    if (*iter == '~') {
+      ++iter;
+      assert(iter != std::end(sv) && (*iter == '0' || *iter == '1') && "invalid escape sequence in json pointer");
+      *out++ = *iter == '1' ? '/' : '~';
+    } else {
+      *out++ = *iter;
+    }
+  }
+  return out;
+}
+
+/**
+ * @brief moves from an array or object to the child addressed by a single reference token
+ */
+constexpr std::optional<lazy_value> step(const lazy_value& current,
+                                         std::string_view key,
+                                         std::optional<std::size_t> index) {
+  if (current.type() == parser::value_type::array) {
+    return index ? current.at(*index) : std::nullopt;
+  }
+  if (current.type() == parser::value_type::object) {
+    return current.find(key);
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief a json pointer split into its unescaped reference tokens at compile time
+ */
+template<detail::fixed_string Path>
+struct compiled {
+  static constexpr auto path = Path.view();
+
+  static_assert(path.empty() || path.front() == '/', "a json pointer has to start with /");
+
+  static constexpr std::size_t tokenCount = static_cast<std::size_t>(std::count(std::begin(path), std::end(path), '/'));
+
+  static constexpr auto buffer = [] {
+    std::array<char, Path.size()> result{};
+    auto out = std::begin(result);
+    for (std::size_t begin = 1; begin <= std::size(path);) {
+      const auto end = std::min(path.find('/', begin), std::size(path));
+      out = unescape(path.substr(begin, end - begin), out);
+      begin = end + 1;
+    }
+    return result;
+  }();
+
+  static constexpr auto tokens = [] {
+    std::array<token, tokenCount> result{};
+    std::size_t offset = 0;
+    std::size_t i = 0;
+    for (std::size_t begin = 1; begin <= std::size(path); ++i) {
+      const auto end = std::min(path.find('/', begin), std::size(path));
+      std::array<char, Path.size()> unescaped{};
+      const auto size = static_cast<std::size_t>(unescape(path.substr(begin, end - begin), std::begin(unescaped)) -
+                                                 std::begin(unescaped));
+      result[i] = token{offset, size, as_index(std::string_view(std::data(unescaped), size))};
+      offset += size;
+      begin = end + 1;
+    }
+    return result;
+  }();
+
+  template<std::size_t I>
+  static constexpr std::optional<lazy_value> step(const lazy_value& current) {
+    constexpr auto t = tokens[I];
+    constexpr auto key = std::string_view(std::data(buffer) + t.offset, t.size);
+    return pointer_helper::step(current, key, t.index);
+  }
+
+  template<std::size_t... Is>
+  static constexpr std::optional<lazy_value> resolve(const lazy_value& root, std::index_sequence<Is...>) {
+    std::optional<lazy_value> current = root;
+    ((current = current ? step<Is>(*current) : std::nullopt), ...);
+    return current;
+  }
+};
+
+} // namespace pointer_helper
+
+/**
+ * @brief resolves a json pointer (RFC 6901) without parsing anything but the path to the addressed value
+ *
+ * The reference tokens are compared with the decoded member names, so /ab also addresses a member written as "a\u0062".
+ *
+ * @return the addressed value or std::nullopt if the document has no such value
+ */
+constexpr std::optional<lazy_value> resolve(std::string_view sv, std::string_view pointer) {
+  assert((pointer.empty() || pointer.starts_with('/')) && "a json pointer has to start with /");
+
+  std::optional<lazy_value> current = lazy_value(sv);
+  std::string unescaped;
+
+  for (std::size_t begin = 1; current && begin <= std::size(pointer);) {
+    const auto end = std::min(pointer.find('/', begin), std::size(pointer));
+    auto key = pointer.substr(begin, end - begin);
+
+    if (key.find('~') != std::string_view::npos) {
+      unescaped.clear();
+      pointer_helper::unescape(key, std::back_inserter(unescaped));
+      key = unescaped;
+    }
+
+    current = pointer_helper::step(*current, key, pointer_helper::as_index(key));
+    begin = end + 1;
+  }
+
+  return current;
+}
+
+template<detail::fixed_string Pointer>
+constexpr std::optional<lazy_value> resolve(std::string_view sv) {
+  using compiled = pointer_helper::compiled<Pointer>;
+  return compiled::resolve(lazy_value(sv), std::make_index_sequence<compiled::tokenCount>{});
+}
+
+/**
+ * @brief deserializes only the value addressed by a json pointer
+ *
+ * jflect::extract<double>(sv, "/orders/17/price") skips everything in front of the price and stops reading after it.
+ */
+template<class T>
+  requires(std::is_default_constructible_v<T>)
+std::optional<T> extract(std::string_view sv, std::string_view pointer) {
+  const auto value = resolve(sv, pointer);
+  if (!value)
+    return std::nullopt;
+  return value->get<T>();
+}
+
+// the path is split at compile time and every key comparison is against a constant
+template<class T, detail::fixed_string Pointer>
+  requires(std::is_default_constructible_v<T>)
+std::optional<T> extract(std::string_view sv) {
+  const std::optional<lazy_value> value = resolve<Pointer>(sv);
+  if (!value)
+    return std::nullopt;
+  return value->get<T>();
+}
+
+} // namespace jflect
+#endif // JFLECT_POINTER_HPP_
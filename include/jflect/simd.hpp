@@ -0,0 +1,115 @@
+#ifndef JFLECT_SIMD_HPP_
+#define JFLECT_SIMD_HPP_
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define JFLECT_SIMD_SSE2 1
+#endif
+
+#if defined(__SSSE3__) || defined(__AVX__)
+#include <tmmintrin.h>
+#define JFLECT_SIMD_SSSE3 1
+#endif
+
+namespace jflect::simd {
+
+inline constexpr std::size_t block_size = 16;
+
+// one bit per byte of a block, the lowest bit is the first byte
+using mask = std::uint32_t;
+
+/**
+ * @brief 16 bytes which are classified at once
+ *
+ * Uses SSE2 if available and a portable loop otherwise. Not usable during constant evaluation.
+ */
+struct block {
+#ifdef JFLECT_SIMD_SSE2
+  __m128i m_bytes;
+
+  static block load(const char* ptr) noexcept {
+    return {_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr))};
+  }
+
+  [[nodiscard]] mask eq(char c) const noexcept {
+    return static_cast<mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(m_bytes, _mm_set1_epi8(c))));
+  }
+
+  // bytes which are smaller than c (unsigned comparison)
+  [[nodiscard]] mask lt(unsigned char c) const noexcept {
+    const auto max = _mm_set1_epi8(static_cast<char>(c - 1));
+    return static_cast<mask>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(m_bytes, max), max)));
+  }
+
+  // bytes with the most significant bit set (non ascii)
+  [[nodiscard]] mask high() const noexcept { return static_cast<mask>(_mm_movemask_epi8(m_bytes)); }
+#else
+  std::array<unsigned char, block_size> m_bytes;
+
+  static block load(const char* ptr) noexcept {
+    block result;
+    std::memcpy(std::data(result.m_bytes), ptr, block_size);
+    return result;
+  }
+
+  template<class UnaryPredicate>
+  [[nodiscard]] mask classify(UnaryPredicate p) const noexcept {
+    mask result = 0;
+    for (std::size_t i = 0; i < block_size; ++i) {
+      result |= static_cast<mask>(p(m_bytes[i])) << i;
+    }
+    return result;
+  }
+
+  [[nodiscard]] mask eq(char c) const noexcept {
+    return classify([c](unsigned char b) { return b == static_cast<unsigned char>(c); });
+  }
+
+  [[nodiscard]] mask lt(unsigned char c) const noexcept {
+    return classify([c](unsigned char b) { return b < c; });
+  }
+
+  [[nodiscard]] mask high() const noexcept {
+    return classify([](unsigned char b) { return b >= 0x80u; });
+  }
+#endif
+
+  // bytes which are equal to any of the given characters
+  template<class... Chars>
+  [[nodiscard]] mask any_of(Chars... cs) const noexcept {
+    return (eq(cs) | ...);
+  }
+};
+
+/**
+ * @brief finds the first character for which blockMask (on whole blocks) or byteMatch (on single bytes) is true
+ *
+ * @param blockMask maps a simd::block to a mask of matching bytes
+ * @param byteMatch the equivalent predicate for a single character, used for the tail and during constant evaluation
+ * @return a pointer to the first matching character or last
+ */
+template<class BlockMask, class BytePredicate>
+constexpr const char* find_if(const char* first, const char* last, BlockMask blockMask, BytePredicate byteMatch) {
+  if (!std::is_constant_evaluated()) {
+    for (; last - first >= static_cast<std::ptrdiff_t>(block_size); first += block_size) {
+      if (const auto m = blockMask(block::load(first)); m != 0) {
+        return first + std::countr_zero(m);
+      }
+    }
+  }
+
+  for (; first != last; ++first) {
+    if (byteMatch(*first))
+      return first;
+  }
+  return last;
+}
+
+} // namespace jflect::simd
+#endif // JFLECT_SIMD_HPP_
@@ -0,0 +1,189 @@
+#ifndef JFLECT_TAGGED_UNION_HPP_
+#define JFLECT_TAGGED_UNION_HPP_
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <utility>
+#include <variant>
+
+#include "helper.hpp"
+#include "jflect.hpp"
+#include "meta.hpp"
+#include "parser.hpp"
+
+namespace jflect {
+
+/**
+ * @brief the value of a discriminator member, either a string literal or an enumerator which is written as its name
+ */
+struct tag_name {
+  static constexpr std::size_t capacity = 64;
+
+  char data[capacity]{};
+  std::size_t size = 0;
+
+  template<std::size_t N>
+  consteval tag_name(const char (&str)[N]) noexcept : tag_name(std::string_view(str, N - 1)) {}
+
+  template<cpt::enumeration E>
+  consteval tag_name(E value) noexcept : tag_name(meta::enumerator_helper<E>::toString(value)) {}
+
+  consteval explicit tag_name(std::string_view sv) noexcept : size(std::size(sv)) {
+    assert(std::size(sv) <= capacity && "tag is too long");
+    std::copy(std::begin(sv), std::end(sv), data);
+  }
+
+  [[nodiscard]] constexpr std::string_view view() const noexcept { return {data, size}; }
+};
+
+// maps the discriminator value Tag to the struct T
+template<tag_name Tag, class T>
+struct tag {
+  using type = T;
+  static constexpr std::string_view name = Tag.view();
+};
+
+/**
+ * @brief a std::variant of structs which is (de)serialized as an object with a discriminator member
+ *
+ * jflect::tagged_union<"type", jflect::tag<"fill", Fill>, jflect::tag<kind::cancel, Cancel>> reads
+ * {"type":"fill","price":1.5} as Fill. The discriminator is written first, which lets the reader select the
+ * alternative without looking further ahead. If the discriminator is not the first member, the reader skips ahead to
+ * find it but still reads the selected struct without an intermediate representation.
+ *
+ * The alternatives are written as objects, so they cannot be positional structs or have a member with the name of
+ * the discriminator.
+ */
+template<detail::fixed_string Key, class... Tags>
+class tagged_union : public std::variant<typename Tags::type...> {
+public:
+  using variant_type = std::variant<typename Tags::type...>;
+  using variant_type::variant;
+
+  static constexpr std::string_view key = Key.view();
+  static constexpr std::array<std::string_view, sizeof...(Tags)> tags{Tags::name...};
+
+  static_assert(sizeof...(Tags) > 0, "a tagged_union needs at least one alternative");
+
+  [[nodiscard]] constexpr variant_type& as_variant() noexcept { return *this; }
+  [[nodiscard]] constexpr const variant_type& as_variant() const noexcept { return *this; }
+
+  /**
+   * @return the index of the alternative with the given tag or std::nullopt
+   */
+  [[nodiscard]] static constexpr std::optional<std::size_t> find_tag(std::string_view name) noexcept {
+    const auto iter = std::find(std::begin(tags), std::end(tags), name);
+    if (iter == std::end(tags))
+      return std::nullopt;
+    return static_cast<std::size_t>(iter - std::begin(tags));
+  }
+};
+
+namespace tagged_union_helper {
+
+/**
+ * @brief finds the value of the discriminator member
+ *
+ * @param sv a view from the begining of an object
+ * @return the raw content of the discriminator string or std::nullopt if the object has no such member
+ */
+constexpr std::optional<std::string_view> find_tag(std::string_view sv, std::string_view key) {
+  parser::trim_read_trim(sv, '{');
+
+  while (sv.starts_with('"')) {
+    const auto afterKey = parser::skip_string(sv);
+    const auto name = sv.substr(1, std::size(sv) - std::size(afterKey) - 2);
+
+    sv = afterKey;
+    parser::trim_read_trim(sv, ':');
+
+    if (name == key) {
+      const auto afterTag = parser::skip_string(sv);
+      return sv.substr(1, std::size(sv) - std::size(afterTag) - 2);
+    }
+
+    sv = parser::skip_value(sv);
+    parser::trim(sv);
+    if (!parser::optional_read(sv, ','))
+      break;
+    parser::trim(sv);
+  }
+
+  return std::nullopt;
+}
+
+template<class A>
+constexpr bool has_member(std::string_view name) noexcept {
+  constexpr auto names = meta::structMemberNames<A>();
+  return std::find(std::begin(names), std::end(names), name) != std::end(names);
+}
+
+// the alternatives are written as objects which start with the discriminator, anything else would not round trip
+template<class U, class Variant = typename U::variant_type>
+struct alternatives;
+
+template<class U, class... As>
+struct alternatives<U, std::variant<As...>> {
+  static constexpr bool positional = (detail::is_positional_v<As> || ...);
+  static constexpr bool shadow_key = (has_member<As>(U::key) || ...);
+
+  static_assert(!positional, "the alternatives of a tagged_union are objects, they cannot be positional");
+  static_assert(!shadow_key, "a member of an alternative has the name of the discriminator");
+
+  static constexpr bool valid = !positional && !shadow_key;
+};
+
+template<class U, std::size_t... Is>
+constexpr auto read_alternative(std::string_view sv, U& value, std::size_t index, std::index_sequence<Is...>)
+    -> decltype(std::begin(sv)) {
+  using fn = const char* (*)(std::string_view sv, U& value);
+
+  constexpr fn readers[] = {[](std::string_view sv, U& value) -> const char* {
+    // the discriminator is an unknown key for the struct, which is skipped
+    return read_to(sv, value.as_variant().template emplace<Is>());
+  }...};
+
+  return readers[index](sv, value);
+}
+
+} // namespace tagged_union_helper
+
+template<class T>
+  requires(detail::is_tagged_union_v<std::remove_cvref_t<T>>)
+constexpr void write_to(std::output_iterator<const char&> auto out, T&& value) {
+  using U = std::remove_cvref_t<T>;
+  static_assert(tagged_union_helper::alternatives<U>::valid);
+
+  const auto tag = U::tags[value.index()];
+
+  out = '{';
+  write_to(out, U::key);
+  out = ':';
+  write_to(out, tag);
+
+  std::visit([&out](const auto& alternative) { struct_helper::write_members(out, alternative, false, U::key); },
+             value.as_variant());
+
+  out = '}';
+}
+
+template<class T>
+  requires(detail::is_tagged_union_v<T>)
+constexpr auto read_to(std::string_view sv, T& value) -> decltype(std::begin(sv)) {
+  static_assert(tagged_union_helper::alternatives<T>::valid);
+
+  const auto tag = tagged_union_helper::find_tag(sv, T::key);
+  assert(tag.has_value() && "the discriminator member is missing");
+
+  const auto index = T::find_tag(tag.value_or(std::string_view()));
+  assert(index.has_value() && "unknown discriminator");
+
+  return tagged_union_helper::read_alternative(
+      sv, value, index.value_or(0), std::make_index_sequence<std::size(T::tags)>{});
+}
+
+} // namespace jflect
+#endif // JFLECT_TAGGED_UNION_HPP_
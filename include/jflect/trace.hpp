@@ -0,0 +1,285 @@
+#ifndef JFLECT_TRACE_HPP_
+#define JFLECT_TRACE_HPP_
+
+/**
+ * Optional tracing of the struct (de)serialization, enabled by defining JFLECT_TRACING=1 (cmake:
+ * -DJFLECT_ENABLE_TRACING=ON). Otherwise the hooks expand to nothing.
+ *
+ * Every struct and every struct member gets a record with the number of calls, the consumed (read) or produced
+ * (write) bytes and the time spent. The time of a struct includes the time of its members. Produced bytes are counted
+ * for the output of jflect::write. Other values (ranges, maps, variants, strings, ...) have no hooks of their own, they
+ * are attributed to the member which holds them and not recorded outside of a struct.
+ *
+ * for (const auto& r : jflect::trace::snapshot())
+ *   std::cout << r.type << '.' << r.member << ": " << r.calls << " calls, " << r.time.count() << "ns\n";
+ */
+#ifndef JFLECT_TRACING
+#define JFLECT_TRACING 0
+#endif
+
+#if JFLECT_TRACING
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "concepts.hpp"
+#include "helper.hpp"
+#include "meta.hpp"
+
+namespace jflect::trace {
+
+enum struct direction { read, write };
+
+struct record {
+  direction dir;
+  std::string_view type;
+  std::string_view member; // empty for the struct itself
+  std::uint64_t calls;
+  std::uint64_t bytes;
+  std::chrono::nanoseconds time;
+};
+
+namespace detail {
+
+template<class T>
+constexpr std::string_view type_name() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+  const auto name = std::string_view(__PRETTY_FUNCTION__); // ... [with T = Name; ...] or [T = Name]
+  const auto begin = name.find("T = ") + 4;
+  return name.substr(begin, name.find_first_of(";]", begin) - begin);
+#elif defined(_MSC_VER)
+  const auto name = std::string_view(__FUNCSIG__); // ... type_name<Name>(void)
+  const auto begin = name.find("type_name<") + 10;
+  return name.substr(begin, name.rfind(">(void)") - begin);
+#else
+  return "unknown";
+#endif
+}
+
+// a counter per struct or member, which registers itself in a global list
+struct site {
+  direction dir;
+  std::string_view type;
+  std::string_view member;
+  std::atomic<std::uint64_t> calls{0};
+  std::atomic<std::uint64_t> bytes{0};
+  std::atomic<std::uint64_t> nanoseconds{0};
+  site* next = nullptr;
+
+  static std::mutex& registry_mutex() {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  static site*& registry() {
+    static site* head = nullptr;
+    return head;
+  }
+
+  site(direction d, std::string_view t, std::string_view m) : dir(d), type(t), member(m) {
+    const auto lock = std::lock_guard(registry_mutex());
+    next = registry();
+    registry() = this;
+  }
+
+  void add(std::uint64_t byteCount, std::chrono::nanoseconds time) noexcept {
+    calls.fetch_add(1, std::memory_order_relaxed);
+    bytes.fetch_add(byteCount, std::memory_order_relaxed);
+    nanoseconds.fetch_add(static_cast<std::uint64_t>(time.count()), std::memory_order_relaxed);
+  }
+};
+
+template<direction D, class T>
+site& type_site() {
+  static site instance(D, type_name<T>(), {});
+  return instance;
+}
+
+template<direction D, class T, std::size_t... Is>
+auto& member_sites(std::index_sequence<Is...>) {
+  static constexpr auto names = meta::structMemberNames<T>();
+  static std::array<site, sizeof...(Is)> instances{site(D, type_name<T>(), names[Is])...};
+  return instances;
+}
+
+template<direction D, class T>
+site& member_site(std::size_t index) {
+  return member_sites<D, T>(std::make_index_sequence<meta::memberCount<T>>{})[index];
+}
+
+// the bytes produced by jflect::write on this thread
+inline thread_local std::uint64_t written = 0;
+
+using clock = std::chrono::steady_clock;
+
+} // namespace detail
+
+/**
+ * @brief measures a read_to call, the consumed bytes are passed to done()
+ */
+template<class T, std::size_t Member = static_cast<std::size_t>(-1)>
+class read_scope {
+public:
+  constexpr explicit read_scope(std::string_view sv) noexcept : m_begin(std::data(sv)) {
+    if (!std::is_constant_evaluated()) {
+      m_start = detail::clock::now();
+    }
+  }
+
+  template<class Iterator>
+  constexpr Iterator done(Iterator end) noexcept {
+    if (!std::is_constant_evaluated()) {
+      const auto bytes = static_cast<std::uint64_t>(std::to_address(end) - m_begin);
+      const auto time = detail::clock::now() - m_start;
+      if constexpr (Member == static_cast<std::size_t>(-1)) {
+        detail::type_site<direction::read, T>().add(bytes, time);
+      } else {
+        detail::member_site<direction::read, T>(Member).add(bytes, time);
+      }
+    }
+    return end;
+  }
+
+private:
+  const char* m_begin;
+  detail::clock::time_point m_start{};
+};
+
+/**
+ * @brief measures a write_to call until the end of its scope
+ */
+template<class T>
+class write_scope {
+public:
+  constexpr explicit write_scope(std::size_t member = static_cast<std::size_t>(-1)) noexcept : m_member(member) {
+    if (!std::is_constant_evaluated()) {
+      m_written = detail::written;
+      m_start = detail::clock::now();
+    }
+  }
+
+  write_scope(const write_scope&) = delete;
+  write_scope& operator=(const write_scope&) = delete;
+
+  constexpr ~write_scope() {
+    if (!std::is_constant_evaluated()) {
+      const auto bytes = detail::written - m_written;
+      const auto time = detail::clock::now() - m_start;
+      if (m_member == static_cast<std::size_t>(-1)) {
+        detail::type_site<direction::write, T>().add(bytes, time);
+      } else {
+        detail::member_site<direction::write, T>(m_member).add(bytes, time);
+      }
+    }
+  }
+
+private:
+  std::size_t m_member;
+  std::uint64_t m_written = 0;
+  detail::clock::time_point m_start{};
+};
+
+/**
+ * @brief forwards to another output iterator and counts the written bytes
+ */
+template<class OutputIt>
+struct counting_iterator {
+  using iterator_category = std::output_iterator_tag;
+  using difference_type = std::ptrdiff_t;
+  using value_type = void;
+  using pointer = void;
+  using reference = void;
+
+  OutputIt m_out;
+
+  constexpr counting_iterator& operator=(char c) {
+    if (!std::is_constant_evaluated()) {
+      ++detail::written;
+    }
+    *m_out++ = c;
+    return *this;
+  }
+
+  // keeps the runs of characters of e.g. detail::string_appender
+  constexpr void append(std::string_view sv)
+    requires requires(OutputIt& out) { out.append(sv); }
+  {
+    if (!std::is_constant_evaluated()) {
+      detail::written += std::size(sv);
+    }
+    m_out.append(sv);
+  }
+
+  constexpr counting_iterator& operator*() noexcept { return *this; }
+  constexpr counting_iterator& operator++() noexcept { return *this; }
+  constexpr counting_iterator& operator++(int) noexcept { return *this; }
+};
+
+template<class OutputIt>
+constexpr auto counted(OutputIt out) noexcept {
+  return counting_iterator<OutputIt>{out};
+}
+
+inline std::vector<record> snapshot() {
+  std::vector<record> result;
+  const auto lock = std::lock_guard(detail::site::registry_mutex());
+  for (auto* s = detail::site::registry(); s != nullptr; s = s->next) {
+    result.push_back(record{s->dir,
+                            s->type,
+                            s->member,
+                            s->calls.load(std::memory_order_relaxed),
+                            s->bytes.load(std::memory_order_relaxed),
+                            std::chrono::nanoseconds(s->nanoseconds.load(std::memory_order_relaxed))});
+  }
+  return result;
+}
+
+inline void reset() {
+  const auto lock = std::lock_guard(detail::site::registry_mutex());
+  for (auto* s = detail::site::registry(); s != nullptr; s = s->next) {
+    s->calls.store(0, std::memory_order_relaxed);
+    s->bytes.store(0, std::memory_order_relaxed);
+    s->nanoseconds.store(0, std::memory_order_relaxed);
+  }
+}
+
+} // namespace jflect::trace
+
+#define JFLECT_TRACE_READ(T, sv) ::jflect::trace::read_scope<T> jflectTrace(sv)
+#define JFLECT_TRACE_READ_MEMBER(T, index, sv) ::jflect::trace::read_scope<T, index> jflectTrace(sv)
+#define JFLECT_TRACE_WRITE(T) const ::jflect::trace::write_scope<std::remove_cvref_t<T>> jflectTrace
+#define JFLECT_TRACE_WRITE_MEMBER(T, index) \
+  const ::jflect::trace::write_scope<std::remove_cvref_t<T>> jflectTrace(index)
+#define JFLECT_TRACE_OUTPUT(out) ::jflect::trace::counted(out)
+
+#else
+
+namespace jflect::trace {
+
+// stands in for read_scope if tracing is disabled
+struct disabled {
+  template<class Iterator>
+  constexpr Iterator done(Iterator end) const noexcept {
+    return end;
+  }
+};
+
+} // namespace jflect::trace
+
+#define JFLECT_TRACE_READ(T, sv) [[maybe_unused]] constexpr ::jflect::trace::disabled jflectTrace {}
+#define JFLECT_TRACE_READ_MEMBER(T, index, sv) [[maybe_unused]] constexpr ::jflect::trace::disabled jflectTrace {}
+#define JFLECT_TRACE_WRITE(T) static_cast<void>(0)
+#define JFLECT_TRACE_WRITE_MEMBER(T, index) static_cast<void>(0)
+#define JFLECT_TRACE_OUTPUT(out) out
+
+#endif
+#endif // JFLECT_TRACE_HPP_
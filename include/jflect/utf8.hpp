@@ -0,0 +1,229 @@
+#ifndef JFLECT_UTF8_HPP_
+#define JFLECT_UTF8_HPP_
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+#include "simd.hpp"
+
+namespace jflect::utf8 {
+
+/**
+ * @brief the length of the utf-8 sequence at the begining of sv
+ *
+ * @return 1 to 4, or 0 if the sequence is malformed, overlong, a surrogate, above U+10FFFF or incomplete
+ */
+constexpr std::size_t sequence_length(std::string_view sv) noexcept {
+  const auto byte = [&](std::size_t i) { return static_cast<unsigned char>(sv[i]); };
+  const auto isContinuation = [&](std::size_t i) { return i < std::size(sv) && (byte(i) & 0xC0u) == 0x80u; };
+
+  // the allowed range of the second byte depends on the first one (unicode table 3-7)
+  unsigned char low = 0x80u;
+  unsigned char high = 0xBFu;
+  std::size_t length = 0;
+
+  const auto first = byte(0);
+  if (first < 0x80u) {
+    return 1;
+  } else if (first < 0xC2u) { // continuation or overlong
+    return 0;
+  } else if (first < 0xE0u) {
+    length = 2;
+  } else if (first < 0xF0u) {
+    length = 3;
+    low = first == 0xE0u ? 0xA0u : 0x80u;  // overlong
+    high = first == 0xEDu ? 0x9Fu : 0xBFu; // surrogates
+  } else if (first < 0xF5u) {
+    length = 4;
+    low = first == 0xF0u ? 0x90u : 0x80u;  // overlong
+    high = first == 0xF4u ? 0x8Fu : 0xBFu; // above U+10FFFF
+  } else {
+    return 0;
+  }
+
+  if (std::size(sv) < length || byte(1) < low || high < byte(1)) {
+    return 0;
+  }
+  for (std::size_t i = 2; i < length; ++i) {
+    if (!isContinuation(i)) {
+      return 0;
+    }
+  }
+  return length;
+}
+
+namespace detail {
+
+constexpr bool is_valid_scalar(std::string_view sv) noexcept {
+  while (!sv.empty()) {
+    const auto length = sequence_length(sv);
+    if (length == 0) {
+      return false;
+    }
+    sv.remove_prefix(length);
+  }
+  return true;
+}
+
+#ifdef JFLECT_SIMD_SSSE3
+/**
+ * @brief validates 16 bytes at a time with the lookup-table method (Keiser, Lemire: "Validating UTF-8 In Less Than One
+ * Instruction Per Byte")
+ *
+ * The high and low nibble of the previous byte and the high nibble of the current byte each look up a set of possible
+ * errors, a byte is malformed if an error is in all three sets. Sequences of 3 and 4 bytes additionally need the
+ * continuations which are checked with the bytes 2 and 3 positions back.
+ */
+class checker {
+public:
+  void feed(__m128i input) noexcept {
+    if (_mm_movemask_epi8(input) == 0) { // ascii only, just a sequence of the previous block can be incomplete
+      m_error = _mm_or_si128(m_error, m_incomplete);
+    } else {
+      const auto prev1 = _mm_alignr_epi8(input, m_previous, 15);
+      const auto prev2 = _mm_alignr_epi8(input, m_previous, 14);
+      const auto prev3 = _mm_alignr_epi8(input, m_previous, 13);
+
+      const auto special = _mm_and_si128(_mm_and_si128(lookup(byte_1_high(), high_nibble(prev1)),
+                                                       lookup(byte_1_low(), _mm_and_si128(prev1, nibble_mask()))),
+                                         lookup(byte_2_high(), high_nibble(input)));
+
+      // the 3rd and 4th byte of a sequence has to be a continuation
+      const auto third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0u - 0x80u)));
+      const auto fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0u - 0x80u)));
+      const auto must23Continuation =
+          _mm_and_si128(_mm_or_si128(third, fourth), _mm_set1_epi8(static_cast<char>(0x80u)));
+
+      m_error = _mm_or_si128(m_error, _mm_xor_si128(must23Continuation, special));
+      m_incomplete = incomplete(input);
+    }
+    m_previous = input;
+  }
+
+  [[nodiscard]] bool valid() const noexcept {
+    const auto error = _mm_or_si128(m_error, m_incomplete);
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+  }
+
+private:
+  // the bits of the lookup tables
+  static constexpr std::uint8_t too_short = 1u << 0u;      // lead byte followed by lead or ascii
+  static constexpr std::uint8_t too_long = 1u << 1u;       // ascii followed by continuation
+  static constexpr std::uint8_t overlong_3 = 1u << 2u;     // 11100000 100_____
+  static constexpr std::uint8_t too_large = 1u << 3u;      // 11110100 1001____ and above
+  static constexpr std::uint8_t surrogate = 1u << 4u;      // 11101101 101_____
+  static constexpr std::uint8_t overlong_2 = 1u << 5u;     // 1100000_ 10______
+  static constexpr std::uint8_t too_large_1000 = 1u << 6u; // 11110101+ 1000____
+  static constexpr std::uint8_t overlong_4 = 1u << 6u;     // 11110000 1000____
+  static constexpr std::uint8_t two_conts = 1u << 7u;      // continuation followed by continuation
+  static constexpr std::uint8_t carry = too_short | too_long | two_conts;
+
+  static __m128i table(const std::array<std::uint8_t, 16>& bytes) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(std::data(bytes)));
+  }
+
+  // indexed by the high nibble of the previous byte
+  static __m128i byte_1_high() noexcept {
+    constexpr std::uint8_t ascii = too_long;
+    return table({ascii, ascii, ascii, ascii, ascii, ascii, ascii, ascii, // 0___
+                  two_conts, two_conts, two_conts, two_conts,             // 10__
+                  too_short | overlong_2,                                 // 1100
+                  too_short,                                              // 1101
+                  too_short | overlong_3 | surrogate,                     // 1110
+                  too_short | too_large | too_large_1000 | overlong_4});  // 1111
+  }
+
+  // indexed by the low nibble of the previous byte
+  static __m128i byte_1_low() noexcept {
+    constexpr std::uint8_t large = carry | too_large | too_large_1000;
+    return table({carry | overlong_3 | overlong_2 | overlong_4, // ____0000
+                  carry | overlong_2,                           // ____0001
+                  carry, carry,                                 // ____001_
+                  carry | too_large,                            // ____0100
+                  large, large, large,                          // ____0101 to ____0111
+                  large, large, large, large, large,            // ____1000 to ____1100
+                  large | surrogate,                            // ____1101
+                  large, large});                               // ____111_
+  }
+
+  // indexed by the high nibble of the current byte
+  static __m128i byte_2_high() noexcept {
+    constexpr std::uint8_t lead = too_short;
+    return table({lead, lead, lead, lead, lead, lead, lead, lead,                                // 0___
+                  too_long | overlong_2 | two_conts | overlong_3 | too_large_1000 | overlong_4, // 1000
+                  too_long | overlong_2 | two_conts | overlong_3 | too_large,                   // 1001
+                  too_long | overlong_2 | two_conts | surrogate | too_large,                    // 101_
+                  too_long | overlong_2 | two_conts | surrogate | too_large,
+                  lead, lead, lead, lead}); // 11__
+  }
+
+  static __m128i nibble_mask() noexcept { return _mm_set1_epi8(0x0F); }
+
+  static __m128i high_nibble(__m128i v) noexcept { return _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask()); }
+
+  static __m128i lookup(__m128i t, __m128i index) noexcept { return _mm_shuffle_epi8(t, index); }
+
+  // a lead byte in the last 3 bytes whose sequence continues in the next block
+  static __m128i incomplete(__m128i input) noexcept {
+    const auto max = table({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, //
+                            0xF0u - 1u, 0xE0u - 1u, 0xC0u - 1u});
+    return _mm_subs_epu8(input, max);
+  }
+
+  __m128i m_error = _mm_setzero_si128();
+  __m128i m_previous = _mm_setzero_si128();
+  __m128i m_incomplete = _mm_setzero_si128();
+};
+#endif
+
+} // namespace detail
+
+/**
+ * @brief checks that sv is well-formed utf-8
+ *
+ * Uses the lookup-table method with SSSE3 (-mssse3, not part of the default x86-64 flags), otherwise ascii blocks are
+ * skipped with simd::block and the rest is checked per sequence. The latter is also used during constant evaluation.
+ */
+constexpr bool is_valid(std::string_view sv) noexcept {
+  if (std::is_constant_evaluated()) {
+    return detail::is_valid_scalar(sv);
+  }
+
+#ifdef JFLECT_SIMD_SSSE3
+  auto checker = detail::checker();
+  for (; std::size(sv) >= simd::block_size; sv.remove_prefix(simd::block_size)) {
+    checker.feed(_mm_loadu_si128(reinterpret_cast<const __m128i*>(std::data(sv))));
+  }
+
+  // the tail is padded with ascii
+  char tail[simd::block_size] = {};
+  if (!sv.empty()) {
+    std::memcpy(tail, std::data(sv), std::size(sv));
+  }
+  checker.feed(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tail)));
+  return checker.valid();
+#else
+  const auto last = std::data(sv) + std::size(sv);
+  const auto isHigh = [](char c) { return static_cast<unsigned char>(c) >= 0x80u; };
+
+  for (;;) {
+    const auto first = simd::find_if(
+        std::data(sv), last, [](const simd::block& b) { return b.high(); }, isHigh);
+    sv = std::string_view(first, static_cast<std::size_t>(last - first));
+    if (sv.empty()) {
+      return true;
+    }
+    const auto length = sequence_length(sv);
+    if (length == 0) {
+      return false;
+    }
+    sv.remove_prefix(length);
+  }
+#endif
+}
+
+} // namespace jflect::utf8
+#endif // JFLECT_UTF8_HPP_
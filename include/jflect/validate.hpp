@@ -0,0 +1,38 @@
+#ifndef JFLECT_VALIDATE_HPP_
+#define JFLECT_VALIDATE_HPP_
+#include <cstddef>
+#include <string_view>
+
+#include "parser.hpp"
+
+namespace jflect {
+
+/**
+ * @brief checks whether sv is one well-formed json-value, surrounded by whitespace only
+ *
+ * Nothing is materialized: the grammar of parser::scan_value is checked on the fly, strings and whitespace are scanned
+ * a simd::block at a time and the content of strings has to be well-formed utf-8. Unlike the asserts of read the
+ * checks are part of release builds, so it is suitable for untrusted input.
+ *
+ * if (const auto result = jflect::validate(payload); !result)
+ *   reject(result.pos, result.error);
+ *
+ * @tparam MaxDepth the maximum number of nested arrays and objects
+ * @return the size of sv, or the offset and kind of the first error
+ */
+template<std::size_t MaxDepth = JFLECT_MAX_DEPTH>
+constexpr parser::scan_result validate(std::string_view sv) noexcept {
+  const auto result = parser::scan_value<MaxDepth, true>(sv);
+  if (!result) {
+    return result;
+  }
+
+  const auto end = parser::detail::skip_whitespace(sv, result.pos);
+  if (end != std::size(sv)) {
+    return {end, parser::scan_error::unexpected_character}; // trailing content
+  }
+  return {end, parser::scan_error::none};
+}
+
+} // namespace jflect
+#endif // JFLECT_VALIDATE_HPP_
@@ -0,0 +1,478 @@
+#ifndef JFLECT_VALUE_HPP_
+#define JFLECT_VALUE_HPP_
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <cstdint>
+#include <iterator>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "jflect.hpp"
+#include "parser.hpp"
+
+namespace jflect {
+
+/**
+ * The tape is a flat array of 64-bit entries. The upper 8 bits of an entry hold its tag and the lower 56 bits its
+ * payload:
+ *
+ * - null, true, false: no payload
+ * - int64, uint64, float64: the value is stored in the following entry
+ * - string: the payload is the offset into the string buffer, the length is stored in the following entry
+ * - array_begin, object_begin: the lower 32 bits of the payload are the index past the matching end entry and the
+ *   upper 24 bits are the number of elements (saturated at max_count)
+ * - array_end, object_end: the payload is the index of the matching begin entry
+ *
+ * Object members are stored as a string entry for the key followed by the value.
+ */
+namespace tape {
+
+enum struct tag : std::uint8_t {
+  null = 'n',
+  true_value = 't',
+  false_value = 'f',
+  int64 = 'l',
+  uint64 = 'u',
+  float64 = 'd',
+  string = '"',
+  array_begin = '[',
+  array_end = ']',
+  object_begin = '{',
+  object_end = '}',
+};
+
+inline constexpr std::uint64_t payload_mask = (std::uint64_t(1) << 56u) - 1u;
+inline constexpr std::uint64_t max_count = (std::uint64_t(1) << 24u) - 1u;
+
+[[nodiscard]] constexpr std::uint64_t make(tag t, std::uint64_t payload = 0) noexcept {
+  assert(payload <= payload_mask);
+  return (static_cast<std::uint64_t>(t) << 56u) | payload;
+}
+
+[[nodiscard]] constexpr tag tag_of(std::uint64_t entry) noexcept { return static_cast<tag>(entry >> 56u); }
+
+[[nodiscard]] constexpr std::uint64_t payload_of(std::uint64_t entry) noexcept { return entry & payload_mask; }
+
+[[nodiscard]] constexpr std::uint64_t make_container(tag t, std::size_t end, std::size_t count) noexcept {
+  return make(t, static_cast<std::uint64_t>(end) | (std::min(static_cast<std::uint64_t>(count), max_count) << 32u));
+}
+
+[[nodiscard]] constexpr std::size_t container_end(std::uint64_t entry) noexcept {
+  return static_cast<std::size_t>(entry & 0xFFFFFFFFu);
+}
+
+[[nodiscard]] constexpr std::size_t container_count(std::uint64_t entry) noexcept {
+  return static_cast<std::size_t>(payload_of(entry) >> 32u);
+}
+
+/**
+ * @brief the index past the value starting at index
+ */
+[[nodiscard]] constexpr std::size_t next_index(std::span<const std::uint64_t> entries, std::size_t index) noexcept {
+  switch (tag_of(entries[index])) {
+    case tag::null:
+    case tag::true_value:
+    case tag::false_value:
+      return index + 1;
+    case tag::array_begin:
+    case tag::object_begin:
+      return container_end(entries[index]);
+    default:
+      return index + 2;
+  }
+}
+
+} // namespace tape
+
+/**
+ * @brief a non owning cursor into the tape of a jflect::value
+ */
+class value_ref {
+public:
+  constexpr value_ref(std::span<const std::uint64_t> tape, std::string_view strings, std::size_t index) noexcept
+      : m_tape(tape), m_strings(strings), m_index(index) {}
+
+  [[nodiscard]] constexpr tape::tag tag() const noexcept { return tape::tag_of(m_tape[m_index]); }
+
+  [[nodiscard]] constexpr parser::value_type type() const noexcept {
+    switch (tag()) {
+      case tape::tag::null:
+        return parser::value_type::null;
+      case tape::tag::true_value:
+      case tape::tag::false_value:
+        return parser::value_type::boolean;
+      case tape::tag::string:
+        return parser::value_type::string;
+      case tape::tag::array_begin:
+        return parser::value_type::array;
+      case tape::tag::object_begin:
+        return parser::value_type::object;
+      default:
+        return parser::value_type::number;
+    }
+  }
+
+  [[nodiscard]] constexpr bool is_null() const noexcept { return tag() == tape::tag::null; }
+
+  struct sentinel {};
+
+  /**
+   * @brief iterates over the elements of an array or the members of an object
+   */
+  template<bool IsObject>
+  struct iterator {
+    using iterator_category = std::input_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::conditional_t<IsObject, std::pair<std::string_view, value_ref>, value_ref>;
+
+    std::span<const std::uint64_t> m_tape;
+    std::string_view m_strings;
+    std::size_t m_index;
+
+    constexpr value_type operator*() const {
+      const auto current = value_ref(m_tape, m_strings, m_index);
+      if constexpr (IsObject) {
+        return {current.get<std::string_view>(), current.sibling(current.next_index())};
+      } else {
+        return current;
+      }
+    }
+
+    constexpr iterator& operator++() noexcept {
+      m_index = tape::next_index(m_tape, m_index);
+      if constexpr (IsObject) {
+        m_index = tape::next_index(m_tape, m_index);
+      }
+      return *this;
+    }
+
+    constexpr iterator operator++(int) noexcept {
+      auto tmp = *this;
+      ++(*this);
+      return tmp;
+    }
+
+    constexpr bool operator==(const sentinel&) const noexcept {
+      const auto t = tape::tag_of(m_tape[m_index]);
+      return t == tape::tag::array_end || t == tape::tag::object_end;
+    }
+  };
+
+  template<bool IsObject>
+  struct range {
+    iterator<IsObject> m_begin;
+
+    constexpr iterator<IsObject> begin() const noexcept { return m_begin; }
+    constexpr sentinel end() const noexcept { return {}; }
+  };
+
+  [[nodiscard]] constexpr range<false> elements() const noexcept {
+    assert(tag() == tape::tag::array_begin && "value is not an array");
+    return {{m_tape, m_strings, m_index + 1}};
+  }
+
+  [[nodiscard]] constexpr range<true> members() const noexcept {
+    assert(tag() == tape::tag::object_begin && "value is not an object");
+    return {{m_tape, m_strings, m_index + 1}};
+  }
+
+  /**
+   * @brief converts a scalar to T
+   *
+   * T can be bool, an arithmetic type, std::string_view (which views the string buffer) or an owning string type.
+   */
+  template<class T>
+  [[nodiscard]] constexpr T get() const {
+    if constexpr (std::same_as<T, bool>) {
+      assert(type() == parser::value_type::boolean);
+      return tag() == tape::tag::true_value;
+    } else if constexpr (std::is_arithmetic_v<T>) {
+      // only numbers have a second word, a null or boolean can be the last one of the tape
+      switch (tag()) {
+        case tape::tag::int64:
+          return static_cast<T>(static_cast<std::int64_t>(m_tape[m_index + 1]));
+        case tape::tag::uint64:
+          return static_cast<T>(m_tape[m_index + 1]);
+        case tape::tag::float64:
+          return static_cast<T>(std::bit_cast<double>(m_tape[m_index + 1]));
+        default:
+          assert(false && "value is not a number");
+          return {};
+      }
+    } else {
+      assert(tag() == tape::tag::string && "value is not a string");
+      const auto str = m_strings.substr(static_cast<std::size_t>(tape::payload_of(m_tape[m_index])),
+                                        static_cast<std::size_t>(m_tape[m_index + 1]));
+      return T(std::begin(str), std::end(str));
+    }
+  }
+
+  /**
+   * @brief the index past this value on the tape
+   */
+  [[nodiscard]] constexpr std::size_t next_index() const noexcept { return tape::next_index(m_tape, m_index); }
+
+  /**
+   * @brief counts the elements of an array or the members of an object
+   */
+  [[nodiscard]] constexpr std::size_t size() const noexcept {
+    const auto count = tape::container_count(m_tape[m_index]);
+    if (count < tape::max_count)
+      return count;
+    if (tag() == tape::tag::array_begin)
+      return static_cast<std::size_t>(std::ranges::distance(elements()));
+    return static_cast<std::size_t>(std::ranges::distance(members()));
+  }
+
+  [[nodiscard]] constexpr std::optional<value_ref> find(std::string_view key) const {
+    assert(tag() == tape::tag::object_begin && "value is not an object");
+    for (auto&& [name, member] : members()) {
+      if (name == key)
+        return member;
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] constexpr std::optional<value_ref> at(std::size_t index) const {
+    assert(tag() == tape::tag::array_begin && "value is not an array");
+    for (auto&& element : elements()) {
+      if (index-- == 0)
+        return element;
+    }
+    return std::nullopt;
+  }
+
+  [[nodiscard]] constexpr value_ref operator[](std::string_view key) const {
+    const auto result = find(key);
+    assert(result.has_value() && "object has no such member");
+    return *result;
+  }
+
+  [[nodiscard]] constexpr value_ref operator[](std::size_t index) const {
+    const auto result = at(index);
+    assert(result.has_value() && "array index out of range");
+    return *result;
+  }
+
+private:
+  [[nodiscard]] constexpr value_ref sibling(std::size_t index) const noexcept { return {m_tape, m_strings, index}; }
+
+  std::span<const std::uint64_t> m_tape;
+  std::string_view m_strings;
+  std::size_t m_index;
+};
+
+/**
+ * @brief a dynamically typed json-value
+ *
+ * The whole document is stored in one tape and one string buffer instead of one allocation per node.
+ */
+class value {
+public:
+  value() { m_tape.push_back(jflect::tape::make(jflect::tape::tag::null)); }
+
+  [[nodiscard]] value_ref root() const noexcept { return {m_tape, m_strings, 0}; }
+
+  [[nodiscard]] parser::value_type type() const noexcept { return root().type(); }
+  [[nodiscard]] bool is_null() const noexcept { return root().is_null(); }
+  [[nodiscard]] std::size_t size() const noexcept { return root().size(); }
+
+  template<class T>
+  [[nodiscard]] T get() const {
+    return root().get<T>();
+  }
+
+  [[nodiscard]] value_ref operator[](std::string_view key) const { return root()[key]; }
+  [[nodiscard]] value_ref operator[](std::size_t index) const { return root()[index]; }
+
+  [[nodiscard]] std::span<const std::uint64_t> tape() const noexcept { return m_tape; }
+  [[nodiscard]] std::string_view strings() const noexcept { return m_strings; }
+
+private:
+  friend auto read_to(std::string_view sv, value& result) -> decltype(std::begin(sv));
+
+  std::vector<std::uint64_t> m_tape;
+  std::string m_strings;
+};
+
+namespace value_helper {
+
+struct tape_builder {
+  std::vector<std::uint64_t>& entries;
+  std::string& strings;
+
+  std::string_view build(std::string_view sv) {
+    parser::trim(sv);
+    assert(!sv.empty());
+
+    switch (sv.front()) {
+      case '{':
+        return build_container(sv, tape::tag::object_begin, tape::tag::object_end);
+      case '[':
+        return build_container(sv, tape::tag::array_begin, tape::tag::array_end);
+      case '"':
+        return build_string(sv);
+      case 't':
+        entries.push_back(tape::make(tape::tag::true_value));
+        return parser::read_other(sv);
+      case 'f':
+        entries.push_back(tape::make(tape::tag::false_value));
+        return parser::read_other(sv);
+      case 'n':
+        entries.push_back(tape::make(tape::tag::null));
+        return parser::read_other(sv);
+      default:
+        return build_number(sv);
+    }
+  }
+
+  std::string_view build_container(std::string_view sv, tape::tag begin, tape::tag end) {
+    const auto isObject = begin == tape::tag::object_begin;
+    const auto start = std::size(entries);
+    entries.push_back(tape::make(begin));
+
+    parser::trim_read_trim(sv, isObject ? '{' : '[');
+
+    std::size_t count = 0;
+    if (!parser::optional_read(sv, isObject ? '}' : ']')) {
+      for (;;) {
+        if (isObject) {
+          sv = build_string(sv);
+          parser::trim_read(sv, ':');
+        }
+        sv = build(sv);
+        ++count;
+
+        parser::trim(sv);
+        if (!parser::optional_read(sv, ','))
+          break;
+      }
+      parser::trim_read(sv, isObject ? '}' : ']');
+    }
+
+    entries.push_back(tape::make(end, start));
+    entries[start] = tape::make_container(begin, std::size(entries), count);
+    return sv;
+  }
+
+  std::string_view build_string(std::string_view sv) {
+    parser::trim_read(sv, '"');
+
+    const auto offset = std::size(strings);
+    sv = parser::parse_string_append(sv, strings);
+
+    entries.push_back(tape::make(tape::tag::string, offset));
+    entries.push_back(std::size(strings) - offset);
+    return sv;
+  }
+
+  std::string_view build_number(std::string_view sv) {
+    const auto rest = parser::read_number(sv);
+    const auto number = sv.substr(0, std::size(sv) - std::size(rest));
+    const auto first = std::data(number);
+    const auto last = first + std::size(number);
+
+    const auto isIntegral = number.find_first_of(".eE") == std::string_view::npos;
+
+    if (isIntegral) {
+      std::int64_t i;
+      if (const auto [ptr, ec] = std::from_chars(first, last, i); ec == std::errc()) {
+        entries.push_back(tape::make(tape::tag::int64));
+        entries.push_back(static_cast<std::uint64_t>(i));
+        return rest;
+      }
+      std::uint64_t u;
+      if (const auto [ptr, ec] = std::from_chars(first, last, u); ec == std::errc()) {
+        entries.push_back(tape::make(tape::tag::uint64));
+        entries.push_back(u);
+        return rest;
+      }
+    }
+
+    double d;
+    read_to(number, d);
+    entries.push_back(tape::make(tape::tag::float64));
+    entries.push_back(std::bit_cast<std::uint64_t>(d));
+    return rest;
+  }
+};
+
+} // namespace value_helper
+
+inline auto read_to(std::string_view sv, value& result) -> decltype(std::begin(sv)) {
+  result.m_tape.clear();
+  result.m_strings.clear();
+
+  const auto rest = value_helper::tape_builder{result.m_tape, result.m_strings}.build(sv);
+  return std::begin(rest);
+}
+
+void write_to(std::output_iterator<const char&> auto out, const value_ref& value) {
+  switch (value.tag()) {
+    case tape::tag::null: {
+      const auto null = std::string_view("null");
+      detail::write_chars(out, null);
+      break;
+    }
+    case tape::tag::true_value:
+    case tape::tag::false_value:
+      write_to(out, value.get<bool>());
+      break;
+    case tape::tag::int64:
+      write_to(out, value.get<std::int64_t>());
+      break;
+    case tape::tag::uint64:
+      write_to(out, value.get<std::uint64_t>());
+      break;
+    case tape::tag::float64:
+      write_to(out, value.get<double>());
+      break;
+    case tape::tag::string:
+      write_to(out, value.get<std::string_view>());
+      break;
+    case tape::tag::array_begin: {
+      out = '[';
+      bool isFirst = true;
+      for (auto&& element : value.elements()) {
+        if (!isFirst) {
+          out = ',';
+        }
+        write_to(out, element);
+        isFirst = false;
+      }
+      out = ']';
+      break;
+    }
+    case tape::tag::object_begin: {
+      out = '{';
+      bool isFirst = true;
+      for (auto&& [key, mapped] : value.members()) {
+        if (!isFirst) {
+          out = ',';
+        }
+        write_to(out, key);
+        out = ':';
+        write_to(out, mapped);
+        isFirst = false;
+      }
+      out = '}';
+      break;
+    }
+    default:
+      assert(false && "malformed tape");
+      break;
+  }
+}
+
+void write_to(std::output_iterator<const char&> auto out, const value& value) {
+  write_to(out, value.root());
+}
+
+} // namespace jflect
+#endif // JFLECT_VALUE_HPP_
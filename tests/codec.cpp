@@ -0,0 +1,52 @@
+#include "gtest/gtest.h"
+#include "jflect/codec.hpp"
+
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+struct Item {
+  std::string name;
+  int quantity;
+  bool operator==(const Item& other) const = default;
+};
+
+struct Order {
+  long id;
+  std::vector<Item> items;
+  bool operator==(const Order& other) const = default;
+};
+
+// as in a header which does not include jflect.hpp
+JFLECT_DECLARE_CODEC(Order)
+JFLECT_DECLARE_CODEC(std::map<std::string, int>)
+
+// as in the one translation unit which instantiates them
+#include "jflect/jflect.hpp"
+
+JFLECT_DEFINE_CODEC(Order)
+JFLECT_DEFINE_CODEC(std::map<std::string, int>)
+
+TEST(json_codec, write) {
+  const auto order = Order{7, {{"a", 1}, {"b", 2}}};
+  ASSERT_EQ(jflect::codec<Order>::write(order), jflect::write(order));
+  ASSERT_EQ(jflect::codec<Order>::write(order),
+            R"({"id":7,"items":[{"name":"a","quantity":1},{"name":"b","quantity":2}]})");
+
+  std::array<char, 16> buffer{};
+  const auto result = jflect::codec<Order>::write_to_buffer(buffer, order);
+  ASSERT_FALSE(result);
+  ASSERT_EQ(result.size, jflect::write(order).size());
+}
+
+TEST(json_codec, read) {
+  const auto order = Order{7, {{"a", 1}, {"b", 2}}};
+  ASSERT_EQ(jflect::codec<Order>::read(jflect::write(order)), order);
+
+  const auto json = std::string(R"({"x":1,"y":2} tail)");
+  auto map = std::map<std::string, int>{};
+  const auto* end = jflect::codec<std::map<std::string, int>>::read_to(json, map);
+  ASSERT_EQ(map, (std::map<std::string, int>{{"x", 1}, {"y", 2}}));
+  ASSERT_EQ(std::string_view(end), " tail");
+}
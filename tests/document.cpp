@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+#include "jflect/document.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+constexpr auto input = std::string_view(R"({
+  "name": "jflect",
+  "tags": ["json", "reflection", "header-only"],
+  "nested": { "skipped": [{ "a": [1, 2, 3] }, "}]"], "a": { "b": [10, 20, 30, 40] } },
+  "empty": {},
+  "nothing": null
+})");
+
+TEST(json_document, member) {
+  const auto doc = jflect::document(input);
+
+  ASSERT_EQ(doc["name"].get<std::string>(), "jflect");
+  ASSERT_EQ(doc["nested"]["a"]["b"][3].get<int>(), 40);
+  ASSERT_EQ(doc["tags"].get<std::vector<std::string>>(),
+            std::vector<std::string>({"json", "reflection", "header-only"}));
+  ASSERT_TRUE(doc["nothing"].is_null());
+
+  ASSERT_FALSE(doc.root().find("missing").has_value());
+  ASSERT_FALSE(doc["empty"].find("a").has_value());
+  ASSERT_FALSE(doc["tags"].at(3).has_value());
+
+  // escaped member names are compared decoded
+  const auto escaped = jflect::document(R"({"a\u0062": 1, "q\"uote": 2, "a\\b": 3})");
+  ASSERT_EQ(escaped["ab"].get<int>(), 1);
+  ASSERT_EQ(escaped["q\"uote"].get<int>(), 2);
+  ASSERT_EQ(escaped["a\\b"].get<int>(), 3);
+  ASSERT_FALSE(escaped.root().find("a\\u0062").has_value());
+}
+
+TEST(json_document, type) {
+  using jflect::parser::value_type;
+  const auto doc = jflect::document(input);
+
+  ASSERT_EQ(doc.root().type(), value_type::object);
+  ASSERT_EQ(doc["name"].type(), value_type::string);
+  ASSERT_EQ(doc["tags"].type(), value_type::array);
+  ASSERT_EQ(doc["nested"]["a"]["b"][0].type(), value_type::number);
+  ASSERT_EQ(doc["nothing"].type(), value_type::null);
+}
+
+TEST(json_document, size_and_raw) {
+  const auto doc = jflect::document(input);
+
+  ASSERT_EQ(doc.root().size(), 5u);
+  ASSERT_EQ(doc["tags"].size(), 3u);
+  ASSERT_EQ(doc["empty"].size(), 0u);
+  ASSERT_EQ(doc["nested"]["a"].raw(), R"({ "b": [10, 20, 30, 40] })");
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include "jflect/format.hpp"
+
+#include <iterator>
+#include <string>
+#include <string_view>
+
+using namespace std::string_view_literals;
+
+namespace {
+
+constexpr auto compact = R"({"a":[1,-0.5,2E+10,true,false,null],"b":{},"c":[],"d":{"e":"x y","f":"\"\\ \t"}})"sv;
+
+constexpr auto pretty = R"({
+  "a": [
+    1,
+    -0.5,
+    2E+10,
+    true,
+    false,
+    null
+  ],
+  "b": {},
+  "c": [],
+  "d": {
+    "e": "x y",
+    "f": "\"\\ \t"
+  }
+})"sv;
+
+} // namespace
+
+TEST(json_format, minify) {
+  ASSERT_EQ(jflect::minify(pretty), compact);
+  ASSERT_EQ(jflect::minify(compact), compact);
+  ASSERT_EQ(jflect::minify(" \r\n\t[ 1 ,\n\t2 ] \n"), "[1,2]");
+  ASSERT_EQ(jflect::minify(R"(" a \" b \\")"), R"(" a \" b \\")");
+
+  // whitespace and strings which are longer than a simd::block
+  const auto spaces = std::string(40, ' ');
+  const auto text = std::string(R"(spaces    and "quotes" \" in a long string)");
+  ASSERT_EQ(jflect::minify("{\n" + spaces + "\"" + text + "\"" + spaces + ":" + std::string(40, '\t') + "1\n}"),
+            "{\"" + text + "\":1}");
+
+  std::string out;
+  jflect::minify_to(std::back_inserter(out), pretty);
+  ASSERT_EQ(out, compact);
+
+  static_assert([] {
+    std::string str;
+    jflect::minify_to(std::back_inserter(str), "[ 1, 2 ]"sv);
+    return str == "[1,2]";
+  }());
+}
+
+TEST(json_format, reformat) {
+  ASSERT_EQ(jflect::reformat(compact), pretty);
+  ASSERT_EQ(jflect::reformat(pretty), pretty);
+  ASSERT_EQ(jflect::minify(jflect::reformat(compact, 4)), compact);
+  ASSERT_EQ(jflect::reformat("[[1],[ ]]", 1), "[\n [\n  1\n ],\n []\n]");
+  ASSERT_EQ(jflect::reformat("[1,2]", 0), "[\n1,\n2\n]");
+  ASSERT_EQ(jflect::reformat(" 42 "), "42");
+
+  // indentation which is wider than the run of spaces which is written at once
+  const auto deep = std::string(20, '[') + std::string(20, ']');
+  const auto reformatted = jflect::reformat(deep, 3);
+  ASSERT_NE(reformatted.find("\n" + std::string(57, ' ') + "[]\n"), std::string::npos);
+  ASSERT_EQ(jflect::minify(reformatted), deep);
+}
@@ -0,0 +1,44 @@
+#include "gtest/gtest.h"
+#include "jflect/intern.hpp"
+#include "jflect/jflect.hpp"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct Event {
+  jflect::interned_string kind;
+  int count;
+};
+
+TEST(json_intern, read) {
+  jflect::intern_pool pool;
+  const jflect::intern_scope scope(pool);
+
+  const auto a = jflect::read<std::map<jflect::interned_string, int>>(R"({"x":1,"y":2})");
+  const auto b = jflect::read<std::unordered_map<jflect::interned_string, int>>(R"({ "y" : 3 , "x!" : 4 })");
+  ASSERT_EQ(pool.size(), 3);
+
+  // the same characters are stored once
+  ASSERT_EQ(std::next(std::begin(a))->first.data(), b.find(pool.intern("y"))->first.data());
+  ASSERT_EQ(b.at(pool.intern("x!")), 4);
+  ASSERT_EQ(pool.size(), 3);
+
+  const auto events = jflect::read<std::vector<Event>>(R"([{"kind":"x","count":1},{"kind":"z","count":2}])");
+  ASSERT_EQ(events[0].kind.data(), std::begin(a)->first.data());
+  ASSERT_EQ(events[1].kind, pool.intern("z"));
+  ASSERT_EQ(pool.size(), 4);
+}
+
+TEST(json_intern, write) {
+  jflect::intern_pool pool;
+
+  using map_type = std::map<jflect::interned_string, int>;
+  const auto map = map_type{{pool.intern("a\"b"), 1}, {pool.intern("c"), 2}};
+  ASSERT_EQ(jflect::write(map), R"({"a\"b":1,"c":2})");
+
+  const jflect::intern_scope scope(pool);
+  ASSERT_EQ(jflect::read<map_type>(jflect::write(map)), map);
+  ASSERT_EQ(pool.size(), 2);
+}
@@ -0,0 +1,133 @@
+#include "gtest/gtest.h"
+#include "jflect/msgpack.hpp"
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+using namespace std::string_literals;
+
+enum struct side { buy, sell };
+
+struct Order {
+  std::string id;
+  side direction;
+  std::int64_t quantity;
+  double price;
+  std::vector<int> fills;
+  std::optional<std::string> note;
+  bool operator==(const Order& other) const = default;
+};
+
+/*------------------------------- msgpack write -------------------------------*/
+
+TEST(msgpack_write, scalar) {
+  ASSERT_EQ(jflect::msgpack::write(true), "\xc3"s);
+  ASSERT_EQ(jflect::msgpack::write(false), "\xc2"s);
+
+  ASSERT_EQ(jflect::msgpack::write(0), "\x00"s);
+  ASSERT_EQ(jflect::msgpack::write(127), "\x7f"s);
+  ASSERT_EQ(jflect::msgpack::write(128), "\xcc\x80"s);
+  ASSERT_EQ(jflect::msgpack::write(65535), "\xcd\xff\xff"s);
+  ASSERT_EQ(jflect::msgpack::write(65536), "\xce\x00\x01\x00\x00"s);
+  ASSERT_EQ(jflect::msgpack::write(UINT64_MAX), "\xcf\xff\xff\xff\xff\xff\xff\xff\xff"s);
+  ASSERT_EQ(jflect::msgpack::write(-1), "\xff"s);
+  ASSERT_EQ(jflect::msgpack::write(-32), "\xe0"s);
+  ASSERT_EQ(jflect::msgpack::write(-33), "\xd0\xdf"s);
+  ASSERT_EQ(jflect::msgpack::write(-129), "\xd1\xff\x7f"s);
+  ASSERT_EQ(jflect::msgpack::write(INT64_MIN), "\xd3\x80\x00\x00\x00\x00\x00\x00\x00"s);
+
+  ASSERT_EQ(jflect::msgpack::write(1.5f), "\xca\x3f\xc0\x00\x00"s);
+  ASSERT_EQ(jflect::msgpack::write(1.5), "\xcb\x3f\xf8\x00\x00\x00\x00\x00\x00"s);
+
+  ASSERT_EQ(jflect::msgpack::write("abc"), "\xa3"
+                                           "abc"s);
+  ASSERT_EQ(jflect::msgpack::write(std::string(32, 'x')), "\xd9\x20"s + std::string(32, 'x'));
+  ASSERT_EQ(jflect::msgpack::write(side::sell), "\xa4sell"s);
+
+  ASSERT_EQ(jflect::msgpack::write(std::optional<int>()), "\xc0"s);
+  ASSERT_EQ(jflect::msgpack::write(std::optional<int>(5)), "\x05"s);
+}
+
+TEST(msgpack_write, container) {
+  ASSERT_EQ(jflect::msgpack::write(std::vector{1, 2, 3}), "\x93\x01\x02\x03"s);
+  ASSERT_EQ(jflect::msgpack::write(std::vector<int>(16, 0)), "\xdc\x00\x10"s + std::string(16, '\0'));
+  ASSERT_EQ(jflect::msgpack::write(std::tuple{1, "a", false}), "\x93\x01\xa1"
+                                                               "a\xc2"s);
+  ASSERT_EQ(jflect::msgpack::write(std::map<std::string, int>{{"a", 1}, {"b", 2}}), "\x82\xa1"
+                                                                                    "a\x01\xa1"
+                                                                                    "b\x02"s);
+  ASSERT_EQ(jflect::msgpack::write(Order{"x", side::buy, 1, 0.5, {}, {}}),
+            "\x86\xa2id\xa1x\xa9"
+            "direction\xa3"
+            "buy\xa8quantity\x01\xa5price\xcb\x3f\xe0\x00\x00\x00\x00\x00\x00\xa5"
+            "fills\x90\xa4note\xc0"s);
+}
+
+/*------------------------------- msgpack read --------------------------------*/
+
+TEST(msgpack_read, scalar) {
+  ASSERT_EQ(jflect::msgpack::read<bool>("\xc3"), true);
+  ASSERT_EQ(jflect::msgpack::read<int>("\x7f"), 127);
+  ASSERT_EQ(jflect::msgpack::read<int>("\xff"), -1);
+  ASSERT_EQ(jflect::msgpack::read<int>("\xd0\xdf"), -33);
+  ASSERT_EQ(jflect::msgpack::read<int>("\xd1\xff\x7f"), -129);
+  ASSERT_EQ(jflect::msgpack::read<int>("\xcd\xff\xff"), 65535);
+  ASSERT_EQ(jflect::msgpack::read<std::uint64_t>("\xcf\xff\xff\xff\xff\xff\xff\xff\xff"), UINT64_MAX);
+  ASSERT_EQ(jflect::msgpack::read<std::int64_t>("\xd3\x80\x00\x00\x00\x00\x00\x00\x00"s), INT64_MIN);
+
+  ASSERT_EQ(jflect::msgpack::read<double>("\xca\x3f\xc0\x00\x00"s), 1.5);
+  ASSERT_EQ(jflect::msgpack::read<float>("\xcb\x3f\xf8\x00\x00\x00\x00\x00\x00"s), 1.5f);
+  ASSERT_EQ(jflect::msgpack::read<double>("\x05"), 5.0); // integers are accepted for floating points
+
+  ASSERT_EQ(jflect::msgpack::read<std::string>("\xa3"
+                                               "abc"),
+            "abc");
+  ASSERT_EQ(jflect::msgpack::read<side>("\xa4sell"), side::sell);
+
+  // a std::string_view views the input, msgpack strings have no escape sequences
+  const auto input = "\xa3xyz"s;
+  const auto view = jflect::msgpack::read<std::string_view>(input);
+  ASSERT_EQ(view, "xyz");
+  ASSERT_EQ(std::data(view), std::data(input) + 1);
+
+  ASSERT_EQ(jflect::msgpack::read<std::optional<int>>("\xc0"), std::nullopt);
+  ASSERT_EQ(jflect::msgpack::read<std::optional<int>>("\x05"), 5);
+}
+
+TEST(msgpack_read, roundtrip) {
+  const auto vec = std::vector<std::string>{"a", std::string(300, 'b'), ""};
+  ASSERT_EQ(jflect::msgpack::read<std::vector<std::string>>(jflect::msgpack::write(vec)), vec);
+
+  const auto nested = std::vector<std::vector<int>>{{1, -2}, {}, std::vector<int>(20, 70000)};
+  ASSERT_EQ(jflect::msgpack::read<std::vector<std::vector<int>>>(jflect::msgpack::write(nested)), nested);
+
+  const auto map = std::map<std::string, double>{{"pi", 3.14}, {"e", 2.71}};
+  ASSERT_EQ((jflect::msgpack::read<std::map<std::string, double>>(jflect::msgpack::write(map))), map);
+
+  const auto tuple = std::tuple{1, std::string("a"), std::array{1.5, 2.5}};
+  ASSERT_EQ((jflect::msgpack::read<std::tuple<int, std::string, std::array<double, 2>>>(jflect::msgpack::write(tuple))),
+            tuple);
+
+  const auto order = Order{"id-1", side::sell, -300, 12.25, {1, 2, 3}, "first"};
+  ASSERT_EQ(jflect::msgpack::read<Order>(jflect::msgpack::write(order)), order);
+}
+
+TEST(msgpack_read, unknown_members) {
+  struct Small {
+    int quantity;
+    bool operator==(const Small& other) const = default;
+  };
+
+  // every member but quantity is skipped, including nested containers and binary data
+  const auto order = Order{"id-1", side::sell, 7, 12.25, std::vector<int>(40, 1), "first"};
+  ASSERT_EQ(jflect::msgpack::read<Small>(jflect::msgpack::write(order)), Small{7});
+  ASSERT_EQ(jflect::msgpack::read<Small>("\x82\xa3"
+                                         "bin\xc4\x02\x00\x00\xa8quantity\x03"s),
+            Small{3});
+}
@@ -0,0 +1,154 @@
+#include "gtest/gtest.h"
+#include "jflect/jflect.hpp"
+#include "jflect/msgpack.hpp"
+
+#include <optional>
+#include <string>
+#include <variant>
+#include <vector>
+
+/*---------------------------- positional structs ----------------------------*/
+
+struct Person {
+  std::string name;
+  int age;
+  bool operator==(const Person& other) const = default;
+};
+
+struct Team {
+  std::string title;
+  std::vector<Person> members;
+  bool operator==(const Team& other) const = default;
+};
+
+template<>
+inline constexpr auto jflect::struct_encoding_v<Person> = jflect::struct_encoding::positional;
+
+TEST(json_options, positional_write) {
+  ASSERT_EQ(jflect::write(Person{"elizabeth", 24}), R"(["elizabeth",24])");
+  // only the struct which opted in is written positionally
+  ASSERT_EQ(jflect::write(Team{"a", {{"b", 1}, {"c", 2}}}), R"({"title":"a","members":[["b",1],["c",2]]})");
+}
+
+TEST(json_options, positional_read) {
+  ASSERT_EQ(jflect::read<Person>(R"([ "elizabeth" , 24 ])"), (Person{"elizabeth", 24}));
+
+  const auto team = Team{"a", {{"b", 1}, {"c", 2}}};
+  ASSERT_EQ(jflect::read<Team>(jflect::write(team)), team);
+
+  // a positional struct is an array alternative of a variant
+  using V = std::variant<std::string, Person>;
+  ASSERT_EQ(jflect::read<V>(R"(["d",3])"), V(Person{"d", 3}));
+}
+
+TEST(msgpack_options, positional) {
+  using namespace std::string_literals;
+
+  ASSERT_EQ(jflect::msgpack::write(Person{"e", 5}), "\x92\xa1"
+                                                    "e\x05"s);
+  ASSERT_EQ(jflect::msgpack::read<Person>("\x92\xa1"
+                                          "e\x05"s),
+            (Person{"e", 5}));
+}
+
+/*------------------------------ integer enums -------------------------------*/
+
+enum struct color { red, green, blue };
+enum struct level : unsigned char { low = 1, high = 200 };
+
+template<>
+inline constexpr auto jflect::enum_encoding_v<color> = jflect::enum_encoding::integer;
+
+template<>
+inline constexpr auto jflect::enum_encoding_v<level> = jflect::enum_encoding::integer_or_name;
+
+TEST(json_options, enum_integer) {
+  ASSERT_EQ(jflect::write(color::blue), "2");
+  ASSERT_EQ(jflect::write(level::high), "200");
+  ASSERT_EQ(jflect::write(std::vector{color::green, color::red}), "[1,0]");
+
+  ASSERT_EQ(jflect::read<color>(" 2"), color::blue);
+  ASSERT_EQ(jflect::read<level>("200"), level::high);
+  ASSERT_EQ(jflect::read<level>(R"( "high")"), level::high); // both forms are accepted
+  ASSERT_EQ(jflect::read<std::vector<level>>(R"([1,"high"])"), (std::vector{level::low, level::high}));
+
+  using V = std::variant<std::string, color>;
+  ASSERT_EQ(jflect::read<V>("1"), V(color::green));
+}
+
+TEST(msgpack_options, enum_integer) {
+  using namespace std::string_literals;
+
+  ASSERT_EQ(jflect::msgpack::write(color::blue), "\x02"s);
+  ASSERT_EQ(jflect::msgpack::write(level::high), "\xcc\xc8"s);
+
+  ASSERT_EQ(jflect::msgpack::read<color>("\x02"s), color::blue);
+  ASSERT_EQ(jflect::msgpack::read<level>("\xcc\xc8"s), level::high);
+  ASSERT_EQ(jflect::msgpack::read<level>("\xa3low"s), level::low);
+}
+
+/*------------------------------ member omission -----------------------------*/
+
+struct Sparse {
+  int id;
+  std::optional<std::string> note;
+  std::optional<int> count;
+  bool operator==(const Sparse& other) const = default;
+};
+
+struct Defaults {
+  int id;
+  std::string name;
+  std::vector<int> values;
+  std::optional<Sparse> sparse;
+  bool operator==(const Defaults& other) const = default;
+};
+
+// without operator==, its containers are compared element by element
+struct Label {
+  std::string text;
+};
+
+struct Labels {
+  std::vector<Label> all;
+  std::optional<Label> main;
+};
+
+template<>
+inline constexpr auto jflect::member_omission_v<Sparse> = jflect::member_omission::null;
+
+template<>
+inline constexpr auto jflect::member_omission_v<Defaults> = jflect::member_omission::default_value;
+
+template<>
+inline constexpr auto jflect::member_omission_v<Labels> = jflect::member_omission::default_value;
+
+TEST(json_options, omit_null) {
+  ASSERT_EQ(jflect::write(Sparse{0, {}, {}}), R"({"id":0})");
+  ASSERT_EQ(jflect::write(Sparse{1, {}, 2}), R"({"id":1,"count":2})");
+  ASSERT_EQ(jflect::write(Sparse{1, "a", 0}), R"({"id":1,"note":"a","count":0})");
+
+  // omitted members are empty after a read, even if they were not before
+  auto sparse = Sparse{5, "b", 3};
+  jflect::read_to(R"({"id":1})", sparse);
+  ASSERT_EQ(sparse, (Sparse{1, {}, {}}));
+}
+
+TEST(json_options, omit_default_value) {
+  ASSERT_EQ(jflect::write(Defaults{}), "{}");
+  ASSERT_EQ(jflect::write(Defaults{0, "a", {}, Sparse{}}), R"({"name":"a","sparse":{"id":0}})");
+
+  const auto defaults = Defaults{3, "", {1, 2}, {}};
+  ASSERT_EQ(jflect::write(defaults), R"({"id":3,"values":[1,2]})");
+  ASSERT_EQ(jflect::read<Defaults>(jflect::write(defaults)), defaults);
+  ASSERT_EQ(jflect::read<Defaults>("{}"), Defaults{});
+}
+
+TEST(json_options, omit_default_value_without_equality) {
+  ASSERT_EQ(jflect::write(Labels{}), "{}");
+  ASSERT_EQ(jflect::write(Labels{{{""}}, Label{}}), R"({"all":[{"text":""}],"main":{"text":""}})");
+
+  const auto labels = jflect::read<Labels>(R"({"main":{"text":"a"}})");
+  ASSERT_TRUE(labels.all.empty());
+  ASSERT_EQ(labels.main->text, "a");
+}
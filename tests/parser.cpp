@@ -2,8 +2,10 @@
 #include "jflect/parser.hpp"
 
 #include <array>
-#include <utility>
+#include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
 
 using namespace std::string_view_literals;
 
@@ -129,3 +131,86 @@ TEST(json_parser, read_value) {
     ASSERT_EQ(result, sv.substr(pos));
   }
 }
+
+TEST(json_parser, skip_value) {
+  using T = std::pair<std::string_view, std::size_t>;
+  const auto tests = std::array{
+      T{"\ttrue", 5},
+      T{"\nfalse ", 6},
+      T{"null, null", 4},
+      T{"-7432E-4]", 8},
+      T{"\"simple string\" ", 15},
+      T{R"("a string which is longer than one block with \"escaped\" quotes \\", 1)", 68},
+      T{R"("string with \uaF09 unicode", 99999.32)", 28},
+      T{"[]", 2},
+      T{"[ 13e-10, 42.2 , \"not empty \" ] ", 31},
+      T{R"([{"brackets in strings": "]}[{", "nested": [[[], {}], {"a": [1, 2, 3]}]}], "tail")", 73},
+      T{"{  }", 4},
+      T{R"({ "alpha": 2.3, "beta": 50.0 })", 30},
+  };
+
+  for (const auto& [sv, pos] : tests) {
+    ASSERT_EQ(jflect::parser::skip_value(sv), sv.substr(pos));
+    ASSERT_EQ(jflect::parser::skip_value(sv), jflect::parser::read_value(sv));
+  }
+
+  static_assert(jflect::parser::skip_value(R"({"a": ["]", {"b": null}]}, 1)"sv) == ", 1"sv);
+}
+
+TEST(json_parser, scan_value) {
+  using jflect::parser::scan_error;
+  using T = std::tuple<std::string_view, std::size_t, scan_error>;
+  const auto tests = std::array{
+      T{" [1, -2.5e+3, true, null, \"a\\u00fcb\", {\"k\": {}}] , 1", 48, scan_error::none},
+      T{"", 0, scan_error::unexpected_end},
+      T{"[1, 2", 5, scan_error::unexpected_end},
+      T{"[1 2]", 3, scan_error::unexpected_character},
+      T{"[1,]", 3, scan_error::unexpected_character},
+      T{R"({"a" 1})", 5, scan_error::unexpected_character},
+      T{R"({"a": 1])", 7, scan_error::unexpected_character},
+      T{"{1: 2}", 1, scan_error::unexpected_character},
+      T{"tru", 0, scan_error::unexpected_end},
+      T{"trUe", 0, scan_error::unexpected_character},
+      T{"-", 1, scan_error::unexpected_end},
+      T{"1.e5", 2, scan_error::invalid_number},
+      T{"[01]", 2, scan_error::unexpected_character},
+      T{"\"tab\tinside\"", 4, scan_error::invalid_string},
+      T{R"("\x")", 1, scan_error::invalid_string},
+      T{R"("\u12g4")", 1, scan_error::invalid_string},
+      T{R"("open)", 5, scan_error::unexpected_end},
+  };
+
+  for (const auto& [sv, pos, error] : tests) {
+    const auto result = jflect::parser::scan_value(sv);
+    ASSERT_EQ(result.pos, pos) << sv;
+    ASSERT_EQ(result.error, error) << sv;
+  }
+
+  // the stack is bounded, deeper nesting is an error instead of a stack overflow
+  const auto deep = std::string(100000, '[');
+  ASSERT_EQ(jflect::parser::scan_value(std::string_view(deep)).error, scan_error::too_deep);
+  ASSERT_EQ(jflect::parser::scan_value<2>(R"([{"a": []}])"sv).pos, 7);
+  ASSERT_TRUE(jflect::parser::scan_value<3>(R"([{"a": []}])"sv));
+
+  static_assert(jflect::parser::scan_value(R"({"a": [1, {"b": null}]} tail)"sv).pos == 23);
+}
+
+TEST(json_parser, parse_string) {
+  const auto parse = [](std::string_view sv) { return jflect::parser::parse_string(sv); };
+
+  ASSERT_EQ(parse(R"(plain", 1)"), std::pair(std::string("plain"), ", 1"sv));
+  ASSERT_EQ(parse(R"(\"\\\/\b\f\n\r\t")").first, "\"\\/\b\f\n\r\t");
+  ASSERT_EQ(parse(R"(a run which is longer than one block A and another one which is longer")").first,
+            "a run which is longer than one block A and another one which is longer");
+
+  // utf-8 is copied, \u escapes are encoded
+  ASSERT_EQ(parse("gr\xc3\xbc\xc3\x9f\"").first, "gr\xc3\xbc\xc3\x9f");
+  ASSERT_EQ(parse(R"(\u00fc\u20AC")").first, "\xc3\xbc\xe2\x82\xac");
+
+  // a surrogate pair is one codepoint
+  ASSERT_EQ(parse(R"(\ud83d\uDE00")").first, "\xf0\x9f\x98\x80");
+  ASSERT_EQ(parse(R"(x\uD834\udd1ey")").first, "x\xf0\x9d\x84\x9ey");
+  ASSERT_EQ(jflect::parser::read_string(R"("\ud83d\ude00", 1)"sv), ", 1"sv);
+
+  static_assert(jflect::parser::parse_string(R"(\ud83d\uDE00")"sv).first == "\xf0\x9f\x98\x80");
+}
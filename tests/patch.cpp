@@ -0,0 +1,113 @@
+#include "gtest/gtest.h"
+#include "jflect/patch.hpp"
+
+#include <array>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+struct Position {
+  double x;
+  double y;
+  bool operator==(const Position& other) const = default;
+};
+
+struct Player {
+  std::string name;
+  Position position;
+  std::vector<int> inventory;
+  std::optional<Position> target;
+};
+
+struct World {
+  long tick;
+  std::map<std::string, Player> players;
+  std::map<std::string, int> scores;
+};
+
+// sets can not be changed in place, they are read as a whole
+struct Filter {
+  std::set<int> ids;
+  std::vector<std::set<int>> groups;
+};
+
+TEST(json_patch, write_diff) {
+  const auto prev = Player{"a", {1, 2}, {1}, {}};
+
+  ASSERT_EQ(jflect::write_diff(prev, prev), "{}");
+  ASSERT_EQ(jflect::write_diff(prev, Player{"a", {1, 3}, {1}, {}}), R"({"position":{"y":3.000000}})");
+  ASSERT_EQ(jflect::write_diff(prev, Player{"b", {1, 2}, {1, 2}, {}}), R"({"name":"b","inventory":[1,2]})");
+  ASSERT_EQ(jflect::write_diff(prev, Player{"a", {1, 2}, {1}, Position{5, 6}}),
+            R"({"target":{"x":5.000000,"y":6.000000}})");
+  ASSERT_EQ(jflect::write_diff(Player{"a", {1, 2}, {1}, Position{5, 6}}, prev), R"({"target":null})");
+  ASSERT_EQ(jflect::write_diff(Player{"a", {1, 2}, {1}, Position{5, 6}}, Player{"a", {1, 2}, {1}, Position{5, 7}}),
+            R"({"target":{"y":7.000000}})");
+}
+
+TEST(json_patch, write_diff_map) {
+  const auto prev = World{1, {{"a", {"a", {0, 0}, {}, {}}}, {"b", {"b", {0, 0}, {}, {}}}}, {{"a", 1}, {"b", 2}}};
+
+  auto curr = prev;
+  curr.tick = 2;
+  curr.players["a"].position.x = 4;
+  curr.scores.erase("a");
+  curr.scores["c"] = 3;
+
+  ASSERT_EQ(jflect::write_diff(prev, curr),
+            R"({"tick":2,"players":{"a":{"position":{"x":4.000000}}},"scores":{"a":null,"c":3}})");
+}
+
+TEST(json_patch, apply_patch) {
+  const auto prev = World{1, {{"a", {"a", {0, 0}, {1, 2}, Position{1, 1}}}}, {{"a", 1}, {"b", 2}}};
+
+  auto curr = prev;
+  curr.tick = 7;
+  curr.players["a"].inventory = {3};
+  curr.players["a"].target->y = 5;
+  curr.players["c"] = Player{"c", {1, 1}, {}, {}};
+  curr.scores.erase("b");
+
+  auto patched = prev;
+  jflect::apply_patch(jflect::write_diff(prev, curr), patched);
+  ASSERT_EQ(jflect::write(patched), jflect::write(curr));
+
+  // unknown members are skipped, an empty optional is reset by null
+  jflect::apply_patch(R"( { "unknown" : [1] , "players" : { "a" : { "target" : null } } } )", patched);
+  ASSERT_FALSE(patched.players["a"].target.has_value());
+  ASSERT_EQ(patched.tick, 7);
+}
+
+TEST(json_patch, update_to) {
+  auto world = World{1, {{"a", {"a", {0, 0}, {1, 2, 3}, Position{1, 1}}}}, {{"a", 1}, {"b", 2}}};
+  auto& player = world.players["a"];
+  player.name.reserve(32);
+  const auto* name = player.name.data();
+  const auto* inventory = player.inventory.data();
+
+  jflect::update_to(R"({"players":{"a":{"name":"renamed","inventory":[4,5],"target":null}},"scores":{"b":null}})",
+                    world);
+  ASSERT_EQ(world.tick, 1); // absent members are left as they are
+  ASSERT_EQ(player.name, "renamed");
+  ASSERT_EQ(player.name.data(), name); // the storage is kept
+  ASSERT_EQ(player.inventory, (std::vector{4, 5}));
+  ASSERT_EQ(player.inventory.data(), inventory);
+  ASSERT_EQ(player.position, (Position{0, 0}));
+  ASSERT_FALSE(player.target.has_value());
+  ASSERT_EQ(world.scores, (std::map<std::string, int>{{"a", 1}}));
+
+  // objects in arrays are merged, arrays grow at the back
+  auto positions = std::vector<Position>{{1, 2}, {3, 4}};
+  jflect::update_to(R"([{"y":5},{},{"x":6,"y":7}])", positions);
+  ASSERT_EQ(positions, (std::vector<Position>{{1, 5}, {3, 4}, {6, 7}}));
+
+  auto fixed = std::array<Position, 2>{Position{1, 2}, Position{3, 4}};
+  jflect::update_to(R"([{"x":0},{"y":0}])", fixed);
+  ASSERT_EQ(fixed, (std::array<Position, 2>{Position{0, 2}, Position{3, 0}}));
+
+  auto filter = Filter{{1, 2}, {{1}, {2, 3}}};
+  jflect::update_to(R"({"ids":[5,4],"groups":[[7]]})", filter);
+  ASSERT_EQ(filter.ids, (std::set<int>{4, 5}));
+  ASSERT_EQ(filter.groups, (std::vector<std::set<int>>{{7}}));
+}
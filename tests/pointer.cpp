@@ -0,0 +1,41 @@
+#include "gtest/gtest.h"
+#include "jflect/pointer.hpp"
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+constexpr auto input = std::string_view(R"({
+  "id": "order-book",
+  "orders": [{ "price": 1.5, "tags": ["a"] }, { "price": 2.25, "tags": [] }],
+  "a/b": { "m~n": 7 },
+  "17": "object key",
+  "caf\u00e9": { "x\/y": 8 }
+})");
+
+TEST(json_pointer, runtime) {
+  ASSERT_EQ(jflect::extract<std::string>(input, "/id"), "order-book");
+  ASSERT_EQ(jflect::extract<double>(input, "/orders/1/price"), 2.25);
+  ASSERT_EQ(jflect::extract<std::vector<std::string>>(input, "/orders/0/tags"), std::vector<std::string>({"a"}));
+  ASSERT_EQ(jflect::extract<int>(input, "/a~1b/m~0n"), 7);
+  ASSERT_EQ(jflect::extract<std::string>(input, "/17"), "object key");
+  ASSERT_EQ(jflect::extract<int>(input, "/caf\u00e9/x~1y"), 8); // escaped in the json text
+  ASSERT_EQ(jflect::resolve(input, "")->type(), jflect::parser::value_type::object);
+
+  ASSERT_FALSE(jflect::extract<int>(input, "/missing").has_value());
+  ASSERT_FALSE(jflect::extract<double>(input, "/orders/2/price").has_value());
+  ASSERT_FALSE(jflect::extract<double>(input, "/orders/01/price").has_value());
+  ASSERT_FALSE(jflect::extract<int>(input, "/id/0").has_value());
+}
+
+TEST(json_pointer, compile_time) {
+  ASSERT_EQ((jflect::extract<std::string, "/id">(input)), "order-book");
+  ASSERT_EQ((jflect::extract<double, "/orders/1/price">(input)), 2.25);
+  ASSERT_EQ((jflect::extract<int, "/a~1b/m~0n">(input)), 7);
+  ASSERT_EQ((jflect::extract<std::string, "/17">(input)), "object key");
+  ASSERT_EQ((jflect::extract<int, "/caf\u00e9/x~1y">(input)), 8);
+  ASSERT_EQ(jflect::resolve<"">(input)->type(), jflect::parser::value_type::object);
+
+  ASSERT_FALSE((jflect::extract<int, "/missing">(input)).has_value());
+  ASSERT_FALSE((jflect::extract<double, "/orders/2/price">(input)).has_value());
+}
@@ -46,6 +46,26 @@ TEST(json_read, range) {
   ASSERT_EQ(jflect::read<std::vector<std::vector<int>>>("[[1,2],[3,4]]"), nestedRange);
 }
 
+TEST(json_read, numeric_range) {
+  ASSERT_TRUE(jflect::read<std::vector<double>>(" [ ] ").empty());
+  ASSERT_EQ(jflect::read<std::vector<double>>("[0.5, -2,\n1e3 ]"), std::vector({0.5, -2.0, 1e3}));
+  using limits = std::numeric_limits<std::int64_t>;
+  ASSERT_EQ(jflect::read<std::vector<std::int64_t>>("[-9223372036854775808,9223372036854775807]"),
+            (std::vector{limits::min(), limits::max()}));
+  ASSERT_EQ((jflect::read<std::array<float, 3>>("[1.5, 2 ,-3]")), (std::array{1.5f, 2.0f, -3.0f}));
+
+  using Points = std::vector<std::array<double, 3>>;
+  ASSERT_EQ(jflect::read<Points>(R"([[1,2,3], [4.5, 5, 6] ])"), (Points{{1, 2, 3}, {4.5, 5, 6}}));
+
+  using Matrix = std::array<std::array<int, 2>, 2>;
+  ASSERT_EQ(jflect::read<Matrix>("[[1,2],[3,4]]"), (Matrix{{{1, 2}, {3, 4}}}));
+
+  // the rest of the input is returned
+  auto value = std::vector<int>();
+  const auto sv = std::string_view("[1,2], 3");
+  ASSERT_EQ(jflect::read_to(sv, value), std::data(sv) + 5);
+}
+
 TEST(json_read, map) {
   using M1 = std::map<std::string, int>;
   using M2 = std::map<std::string, std::pair<unsigned long, int>>;
@@ -126,4 +146,80 @@ TEST(json_read, tuple) {
   ASSERT_EQ(jflect::read<T2>("[1,3,4]"), T2(1, 3, 4));
   ASSERT_EQ(jflect::read<T3>("[3.300000,-4,\"this is a c-style string\"]"), T3(3.3, -4, "this is a c-style string"));
   ASSERT_EQ(jflect::read<T4>("[\"hello\",\"beautiful\",\"world\"]"), T4("hello", "beautiful", "world"));
-}
\ No newline at end of file
+}
+
+TEST(json_read, constant_evaluation) {
+  enum mode { fast, safe };
+  struct Route {
+    std::string_view path;
+    int port;
+    bool operator==(const Route& other) const = default;
+  };
+  struct Config {
+    std::array<Route, 2> routes;
+    double ratio;
+    unsigned long timeout;
+    mode selected;
+    std::optional<bool> verbose;
+  };
+
+  constexpr auto config = jflect::read<Config>(R"({
+    "routes": [{"path": "/a", "port": 80}, {"port": -1, "unknown": [1, {}], "path": "/b"}],
+    "ratio": 0.25,
+    "timeout": 1500,
+    "selected": "safe",
+    "verbose": null
+  })");
+
+  static_assert(config.routes[0] == Route{"/a", 80});
+  static_assert(config.routes[1] == Route{"/b", -1});
+  static_assert(config.ratio == 0.25);
+  static_assert(config.timeout == 1500);
+  static_assert(config.selected == safe);
+  static_assert(!config.verbose.has_value());
+
+  static_assert(jflect::read<double>("-1.5e3") == -1500.0);
+  static_assert(jflect::read<float>("3.14159") == 3.14159f);
+  static_assert(jflect::read<double>("0.001") == 1e-3);
+  static_assert(jflect::read<double>("1E+22") == 1e22);
+  static_assert(jflect::read<std::uint64_t>("18446744073709551615") == std::numeric_limits<std::uint64_t>::max());
+  static_assert(jflect::read<std::int64_t>("-9223372036854775808") == std::numeric_limits<std::int64_t>::min());
+  // owning strings can be used during constant evaluation as well
+  static_assert(jflect::read<std::string>(R"("escaped \"\u00e9\"")") == "escaped \"\u00e9\"");
+}
+
+/*------------------------------ standard types ------------------------------*/
+
+TEST(json_read, variant) {
+  using V = std::variant<std::monostate, bool, int, double, std::string, std::vector<int>>;
+
+  ASSERT_EQ(jflect::read<V>("null"), V());
+  ASSERT_EQ(jflect::read<V>(" true"), V(true));
+  ASSERT_EQ(jflect::read<V>("42"), V(42));
+  ASSERT_EQ(jflect::read<V>("4.5"), V(4.5));
+  ASSERT_EQ(jflect::read<V>("1e3"), V(1e3));
+  ASSERT_EQ(jflect::read<V>("\"text\""), V(std::string("text")));
+  ASSERT_EQ(jflect::read<V>("[1,2]"), V(std::vector<int>{1, 2}));
+}
+
+TEST(json_read, variant_structure) {
+  struct Fill {
+    std::string order;
+    double price;
+    int quantity;
+    bool operator==(const Fill& other) const = default;
+  };
+
+  struct Cancel {
+    std::string order;
+    std::string reason;
+    bool operator==(const Cancel& other) const = default;
+  };
+
+  using V = std::variant<Fill, Cancel, std::map<std::string, int>>;
+
+  // "order" occurs in both structs, "price"/"quantity" and "reason" decide
+  ASSERT_EQ(jflect::read<V>("{\"order\":\"a\",\"price\":1.5,\"quantity\":3}"), V(Fill{"a", 1.5, 3}));
+  ASSERT_EQ(jflect::read<V>("{\"order\":\"b\",\"reason\":\"expired\"}"), V(Cancel{"b", "expired"}));
+  ASSERT_EQ(jflect::read<V>("{\"order\":\"c\",\"unknown\":{\"reason\":0},\"reason\":\"\"}"), V(Cancel{"c", ""}));
+}
@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+#include "jflect/tagged_union.hpp"
+
+#include <string>
+#include <vector>
+
+enum struct kind { fill, cancel };
+
+struct Fill {
+  std::string order;
+  double price;
+  bool operator==(const Fill& other) const = default;
+};
+
+struct Cancel {
+  std::string order;
+  std::string reason;
+  bool operator==(const Cancel& other) const = default;
+};
+
+using message = jflect::tagged_union<"type", jflect::tag<"fill", Fill>, jflect::tag<kind::cancel, Cancel>>;
+
+TEST(json_tagged_union, write) {
+  ASSERT_EQ(jflect::write(message(Fill{"a", 1.5})), R"({"type":"fill","order":"a","price":1.500000})");
+  ASSERT_EQ(jflect::write(message(Cancel{"b", "late"})), R"({"type":"cancel","order":"b","reason":"late"})");
+}
+
+TEST(json_tagged_union, read) {
+  ASSERT_EQ(jflect::read<message>(R"({"type":"fill","order":"a","price":1.5})"), message(Fill{"a", 1.5}));
+  ASSERT_EQ(jflect::read<message>(R"({ "order": "b", "reason": "late", "type": "cancel" })"),
+            message(Cancel{"b", "late"}));
+  ASSERT_EQ(jflect::read<message>(R"({"order":"c","skipped":{"type":"cancel"},"price":2,"type":"fill"})"),
+            message(Fill{"c", 2.0}));
+
+  const auto messages = std::vector<message>{Fill{"d", 3.0}, Cancel{"e", "late"}};
+  ASSERT_EQ(jflect::read<std::vector<message>>(jflect::write(messages)), messages);
+}
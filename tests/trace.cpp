@@ -0,0 +1,73 @@
+#include "gtest/gtest.h"
+#include "jflect/jflect.hpp"
+
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+static_assert(JFLECT_TRACING, "this test has to be compiled with tracing");
+
+struct Point {
+  int x;
+  int y;
+};
+
+struct Shape {
+  std::string name;
+  std::vector<Point> points;
+};
+
+namespace {
+
+jflect::trace::record find(jflect::trace::direction dir, std::string_view type, std::string_view member = {}) {
+  const auto records = jflect::trace::snapshot();
+  const auto iter = std::find_if(std::begin(records), std::end(records), [&](const auto& r) {
+    return r.dir == dir && r.type == type && r.member == member;
+  });
+  return iter != std::end(records) ? *iter : jflect::trace::record{dir, type, member, 0, 0, {}};
+}
+
+constexpr auto json = std::string_view(R"({"name":"a","points":[{"x":1,"y":2},{"x":3,"y":40}]})");
+
+} // namespace
+
+TEST(json_trace, read) {
+  jflect::trace::reset();
+
+  jflect::read<Shape>(json);
+
+  using jflect::trace::direction;
+
+  const auto shape = find(direction::read, "Shape");
+  ASSERT_EQ(shape.calls, 1u);
+  ASSERT_EQ(shape.bytes, std::size(json));
+
+  ASSERT_EQ(find(direction::read, "Shape", "name").bytes, std::string_view(R"("a")").size());
+  ASSERT_EQ(find(direction::read, "Shape", "points").bytes,
+            std::string_view(R"([{"x":1,"y":2},{"x":3,"y":40}])").size());
+
+  ASSERT_EQ(find(direction::read, "Point").calls, 2u);
+  ASSERT_EQ(find(direction::read, "Point", "y").calls, 2u);
+  ASSERT_EQ(find(direction::read, "Point", "y").bytes, 3u);
+
+  ASSERT_GE(shape.time, find(direction::read, "Point").time); // inclusive
+}
+
+TEST(json_trace, write) {
+  jflect::trace::reset();
+
+  const auto output = jflect::write(jflect::read<Shape>(json));
+  ASSERT_EQ(output, json);
+
+  using jflect::trace::direction;
+
+  ASSERT_EQ(find(direction::write, "Shape").calls, 1u);
+  ASSERT_EQ(find(direction::write, "Shape").bytes, std::size(json));
+  ASSERT_EQ(find(direction::write, "Shape", "name").bytes, 3u);
+  ASSERT_EQ(find(direction::write, "Point", "x").calls, 2u);
+  ASSERT_EQ(find(direction::write, "Point", "y").bytes, 3u);
+
+  jflect::trace::reset();
+  ASSERT_EQ(find(direction::write, "Shape").calls, 0u);
+}
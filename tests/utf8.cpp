@@ -0,0 +1,50 @@
+#include "gtest/gtest.h"
+#include "jflect/utf8.hpp"
+
+#include <string>
+#include <string_view>
+
+using namespace std::string_view_literals;
+
+TEST(utf8, sequence_length) {
+  ASSERT_EQ(jflect::utf8::sequence_length("a"), 1u);
+  ASSERT_EQ(jflect::utf8::sequence_length("\xc3\xbc"), 2u);
+  ASSERT_EQ(jflect::utf8::sequence_length("\xe2\x82\xac"), 3u);
+  ASSERT_EQ(jflect::utf8::sequence_length("\xf0\x9f\x98\x80"), 4u);
+
+  ASSERT_EQ(jflect::utf8::sequence_length("\x80"), 0u);             // continuation
+  ASSERT_EQ(jflect::utf8::sequence_length("\xc0\xaf"), 0u);         // overlong
+  ASSERT_EQ(jflect::utf8::sequence_length("\xe0\x80\xaf"), 0u);     // overlong
+  ASSERT_EQ(jflect::utf8::sequence_length("\xed\xa0\x80"), 0u);     // surrogate
+  ASSERT_EQ(jflect::utf8::sequence_length("\xf4\x90\x80\x80"), 0u); // above U+10FFFF
+  ASSERT_EQ(jflect::utf8::sequence_length("\xe2\x82"), 0u);         // incomplete
+}
+
+TEST(utf8, is_valid) {
+  ASSERT_TRUE(jflect::utf8::is_valid(""));
+  ASSERT_TRUE(jflect::utf8::is_valid("ascii only"));
+  ASSERT_TRUE(jflect::utf8::is_valid("gr\xc3\xbc\xc3\x9f \xe2\x82\xac \xf0\x9f\x98\x80 \xef\xbf\xbf \xf4\x8f\xbf\xbf"));
+
+  ASSERT_FALSE(jflect::utf8::is_valid("\xff"));
+  ASSERT_FALSE(jflect::utf8::is_valid("abc\xc3"));
+  ASSERT_FALSE(jflect::utf8::is_valid("\xed\xbf\xbf"));
+  ASSERT_FALSE(jflect::utf8::is_valid("\xf8\x88\x80\x80\x80"));
+
+  // sequences on every position of the 16 byte blocks
+  const auto sequences = {"\xc3\xbc"sv, "\xe2\x82\xac"sv, "\xf0\x9f\x98\x80"sv};
+  for (const auto sequence : sequences) {
+    for (std::size_t offset = 0; offset < 40; ++offset) {
+      auto str = std::string(offset, 'x') + std::string(sequence) + std::string(20, 'y');
+      ASSERT_TRUE(jflect::utf8::is_valid(str)) << offset;
+
+      str[offset + std::size(sequence) - 1] = 'z'; // incomplete
+      ASSERT_FALSE(jflect::utf8::is_valid(str)) << offset;
+
+      str.resize(offset + std::size(sequence) - 1); // incomplete at the end
+      ASSERT_FALSE(jflect::utf8::is_valid(str)) << offset;
+    }
+  }
+
+  static_assert(jflect::utf8::is_valid("\xc3\xbc"));
+  static_assert(!jflect::utf8::is_valid("\xc3\x28"));
+}
@@ -0,0 +1,37 @@
+#include "gtest/gtest.h"
+
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+struct malformed_utf8 : std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+#define JFLECT_INVALID_UTF8(run) throw malformed_utf8(std::string(run))
+#include "jflect/intern.hpp"
+#include "jflect/jflect.hpp"
+
+static_assert(JFLECT_VALIDATE_UTF8, "this test has to be compiled with utf-8 validation");
+
+#ifndef NDEBUG
+#error "this test checks that the validation does not depend on asserts"
+#endif
+
+TEST(utf8_reject, valid) {
+  ASSERT_EQ(jflect::read<std::string>("\"gr\xc3\xbc\xc3\x9f \\u00e9\""), "gr\xc3\xbc\xc3\x9f \xc3\xa9");
+  ASSERT_EQ(jflect::read<std::vector<std::string>>(R"(["a", "b\"c"])"), (std::vector<std::string>{"a", "b\"c"}));
+}
+
+TEST(utf8_reject, invalid) {
+  ASSERT_THROW(jflect::read<std::string>("\"\xff\""), malformed_utf8);
+  ASSERT_THROW(jflect::read<std::string>("\"a\\n\xed\xa0\x80\""), malformed_utf8); // a surrogate after an escape
+  ASSERT_THROW(jflect::read<std::string>("\"" + std::string(40, 'a') + "\xc3\""), malformed_utf8); // truncated
+  ASSERT_THROW((jflect::read<std::map<std::string, int>>("{\"\xc0\xaf\":1}")), malformed_utf8);    // overlong
+
+  jflect::intern_pool pool;
+  const jflect::intern_scope scope(pool);
+  ASSERT_THROW(jflect::read<jflect::interned_string>("\"\x80\""), malformed_utf8);
+}
@@ -0,0 +1,48 @@
+#include "gtest/gtest.h"
+#include "jflect/validate.hpp"
+
+#include <string>
+#include <string_view>
+
+using namespace std::string_view_literals;
+using jflect::parser::scan_error;
+
+TEST(json_validate, valid) {
+  ASSERT_TRUE(jflect::validate("0"));
+  ASSERT_TRUE(jflect::validate(" \r\n\t[] \n"));
+  ASSERT_TRUE(jflect::validate(R"({"a": [1, -0.5, 2E+10, "ü\n", true, false, null], "b": {}})"));
+  ASSERT_TRUE(jflect::validate("\"gr\xc3\xbc\xc3\x9f \xf0\x9f\x98\x80\""));
+
+  // indentation which is longer than a simd::block
+  const auto pretty = std::string("{\n") + std::string(40, ' ') + "\"a\":" + std::string(40, '\t') + "1\n}" +
+                      std::string(40, '\n');
+  ASSERT_EQ(jflect::validate(pretty).pos, std::size(pretty));
+
+  static_assert(jflect::validate(R"([{"a": "b"}, 1])"sv));
+  static_assert(jflect::validate("[1] x"sv).pos == 4);
+}
+
+TEST(json_validate, invalid) {
+  const auto check = [](std::string_view sv, std::size_t pos, scan_error error) {
+    const auto result = jflect::validate(sv);
+    ASSERT_FALSE(result) << sv;
+    ASSERT_EQ(result.pos, pos) << sv;
+    ASSERT_EQ(result.error, error) << sv;
+  };
+
+  check("", 0, scan_error::unexpected_end);
+  check("   ", 3, scan_error::unexpected_end);
+  check("[1] [2]", 4, scan_error::unexpected_character);
+  check(R"({"a": 1,})", 8, scan_error::unexpected_character);
+  check("+1", 0, scan_error::unexpected_character);
+  check("\"a\xc3\x28\"", 1, scan_error::invalid_string);     // truncated sequence
+  check("\"\xe0\x80\xaf\"", 1, scan_error::invalid_string);  // overlong
+  check("\"\xed\xa0\x80\"", 1, scan_error::invalid_string);  // surrogate
+  check(R"(["a long string which is longer than a block", "and a control character )" "\x01\"]",
+        72,
+        scan_error::invalid_string);
+
+  ASSERT_EQ(jflect::validate<4>("[[[[1]]]]").error, scan_error::none);
+  ASSERT_EQ(jflect::validate<4>("[[[[[1]]]]]").error, scan_error::too_deep);
+  ASSERT_EQ(jflect::validate(std::string(5000, '[')).error, scan_error::too_deep);
+}
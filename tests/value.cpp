@@ -0,0 +1,55 @@
+#include "gtest/gtest.h"
+#include "jflect/value.hpp"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST(json_value, scalar) {
+  using jflect::parser::value_type;
+
+  ASSERT_TRUE(jflect::read<jflect::value>(" null ").is_null());
+  ASSERT_EQ(jflect::read<jflect::value>("true").get<bool>(), true);
+  ASSERT_EQ(jflect::read<jflect::value>("-25").get<int>(), -25);
+  ASSERT_EQ(jflect::read<jflect::value>("18446744073709551615").get<std::uint64_t>(), 18446744073709551615u);
+  ASSERT_DOUBLE_EQ(jflect::read<jflect::value>("1.5e3").get<double>(), 1500.0);
+  ASSERT_EQ(jflect::read<jflect::value>(R"("tab\tbed")").get<std::string>(), "tab\tbed");
+  ASSERT_EQ(jflect::read<jflect::value>("2.0").type(), value_type::number);
+}
+
+TEST(json_value, container) {
+  const auto value = jflect::read<jflect::value>(R"({"name":"jflect","sizes":[1,[2,3],{}],"empty":[]})");
+
+  ASSERT_EQ(value.size(), 3u);
+  ASSERT_EQ(value["name"].get<std::string_view>(), "jflect");
+  ASSERT_EQ(value["sizes"].size(), 3u);
+  ASSERT_EQ(value["sizes"][1][1].get<int>(), 3);
+  ASSERT_EQ(value["sizes"][2].size(), 0u);
+  ASSERT_EQ(value["empty"].size(), 0u);
+  ASSERT_FALSE(value.root().find("missing").has_value());
+
+  std::vector<std::string_view> keys;
+  for (auto&& [key, member] : value.root().members()) {
+    keys.push_back(key);
+  }
+  ASSERT_EQ(keys, std::vector<std::string_view>({"name", "sizes", "empty"}));
+
+  // one tape entry per value plus one per payload and one per container end
+  ASSERT_EQ(std::size(value.tape()), 24u);
+}
+
+TEST(json_value, round_trip) {
+  const auto input = std::string_view(R"({"a":[true,false,null],"b":{"c":-4,"d":"e"},"f":[]})");
+  ASSERT_EQ(jflect::write(jflect::read<jflect::value>(input)), input);
+}
+
+TEST(json_value, typed_interop) {
+  using M = std::map<std::string, jflect::value>;
+
+  const auto map = jflect::read<M>(R"({"first":[1,2,3],"second":{"nested":"value"}})");
+  ASSERT_EQ(map.at("first")[2].get<int>(), 3);
+  ASSERT_EQ(map.at("second")["nested"].get<std::string>(), "value");
+  ASSERT_EQ(jflect::write(map), R"({"first":[1,2,3],"second":{"nested":"value"}})");
+}
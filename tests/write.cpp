@@ -1,9 +1,17 @@
 #include "gtest/gtest.h"
 #include "jflect/jflect.hpp"
 
+#include <array>
+#include <cstdint>
+#include <limits>
 #include <set>
 #include <map>
 #include <optional>
+#include <span>
+#include <string>
+#include <tuple>
+#include <variant>
+#include <vector>
 
 TEST(json_write, boolean) {
   ASSERT_EQ(jflect::write(true), "true");
@@ -82,6 +90,20 @@ TEST(json_write, string) {
   ASSERT_EQ(jflect::write(str), "\"this is a const std::string\"");
 }
 
+TEST(json_write, string_escape) {
+  ASSERT_EQ(jflect::write(R"(say "hi")"), R"("say \"hi\"")");
+  ASSERT_EQ(jflect::write(R"(C:\temp)"), R"("C:\\temp")");
+  ASSERT_EQ(jflect::write("\b\f\n\r\t"), R"("\b\f\n\r\t")");
+  ASSERT_EQ(jflect::write(std::string("\0\x01\x1f\x7f", 4)), "\"\\u0000\\u0001\\u001f\x7f\"");
+  ASSERT_EQ(jflect::write("gr\xc3\xbc\xc3\x9f"), "\"gr\xc3\xbc\xc3\x9f\""); // utf-8 is written as is
+
+  // escapes before, on and after the borders of the 16 byte blocks
+  const auto str = std::string("0123456789abcde\"\"0123456789abcd\n") + std::string(40, 'x') + '\\';
+  const auto json = jflect::write(str);
+  ASSERT_EQ(json, R"("0123456789abcde\"\"0123456789abcd\n)" + std::string(40, 'x') + R"(\\")");
+  ASSERT_EQ(jflect::read<std::string>(json), str);
+}
+
 TEST(json_write, range) {
   ASSERT_EQ(jflect::write(std::initializer_list<int>{}), "[]");
   ASSERT_EQ(jflect::write(std::array{1, 2, 3}), "[1,2,3]");
@@ -93,6 +115,32 @@ TEST(json_write, range) {
   ASSERT_EQ(jflect::write(nestedRange), "[[1,2],[3,4]]");
 }
 
+TEST(json_write, numeric_range) {
+  ASSERT_EQ(jflect::write(std::vector<double>{}), "[]");
+  ASSERT_EQ(jflect::write(std::vector{0.5, -2.0}), "[0.500000,-2.000000]");
+  ASSERT_EQ(jflect::write(std::array{std::numeric_limits<std::int64_t>::min(), std::int64_t{7}}),
+            "[-9223372036854775808,7]");
+  ASSERT_EQ(jflect::write(std::vector<std::array<int, 3>>{{1, 2, 3}, {4, 5, 6}}), "[[1,2,3],[4,5,6]]");
+
+  // larger than the buffer of the writer
+  const auto large = std::vector<std::uint16_t>(5000, 12345);
+  const auto json = jflect::write(large);
+  ASSERT_EQ(std::size(json), 5000u * 6u + 1u);
+  ASSERT_EQ(jflect::read<std::vector<std::uint16_t>>(json), large);
+
+  std::array<char, 16> buffer{};
+  const auto result = jflect::write_to_buffer(buffer, large);
+  ASSERT_TRUE(result.overflow);
+  ASSERT_EQ(result.size, std::size(json));
+  ASSERT_EQ(std::string_view(std::data(buffer), std::size(buffer)), std::string_view(json).substr(0, 16));
+
+  // the longest formatted number, thousands of digits
+  const auto longest = std::numeric_limits<long double>::max();
+  ASSERT_EQ(jflect::write(std::vector<long double>{longest, longest}),
+            "[" + jflect::write(longest) + "," + jflect::write(longest) + "]");
+  ASSERT_EQ(jflect::write(std::array<long double, 1>{longest}), "[" + jflect::write(longest) + "]");
+}
+
 TEST(json_write, map) {
   const std::map<std::string, int> map1{{"first", 42}, {"second", 36}};
   const std::map<std::string, std::pair<unsigned long, int>> map2{{"alpha", {33, -11}}, {"beta", {88, -1}}};
@@ -168,3 +216,41 @@ TEST(json_write, optional) {
   ASSERT_EQ(jflect::write(std::optional<float>(std::nullopt)), "null");
   ASSERT_EQ(jflect::write(std::make_optional("null")), "\"null\"");
 }
+
+TEST(json_write, variant) {
+  using V = std::variant<std::monostate, int, std::string, std::vector<int>>;
+
+  ASSERT_EQ(jflect::write(V()), "null");
+  ASSERT_EQ(jflect::write(V(5)), "5");
+  ASSERT_EQ(jflect::write(V("text")), "\"text\"");
+  ASSERT_EQ(jflect::write(V(std::vector<int>{1, 2})), "[1,2]");
+}
+
+TEST(json_write, buffer) {
+  const auto value = std::map<std::string, std::vector<std::string>>{{"a", {"x", "y\n"}}, {"b", {}}};
+  const auto json = std::string_view(R"({"a":["x","y\n"],"b":[]})");
+
+  std::array<char, 64> buffer{};
+  const auto result = jflect::write_to_buffer(buffer, value);
+  ASSERT_TRUE(result);
+  ASSERT_EQ(std::string_view(std::data(buffer), result.size), json);
+
+  // exactly fitting
+  auto exact = std::vector<char>(std::size(json));
+  ASSERT_TRUE(jflect::write_to_buffer(exact, value));
+  ASSERT_EQ(std::string_view(std::data(exact), std::size(exact)), json);
+
+  // too small, the buffer holds the begining and the required size is reported
+  for (std::size_t size : {std::size_t{0}, std::size_t{1}, std::size(json) - 1}) {
+    auto small = std::vector<char>(size + 1, '#');
+    const auto overflow = jflect::write_to_buffer(std::span(std::data(small), size), value);
+    ASSERT_FALSE(overflow);
+    ASSERT_TRUE(overflow.overflow);
+    ASSERT_EQ(overflow.size, std::size(json));
+    ASSERT_EQ(std::string_view(std::data(small), size), json.substr(0, size));
+    ASSERT_EQ(small.back(), '#'); // nothing is written past the buffer
+  }
+
+  ASSERT_EQ(jflect::write_to_buffer(buffer, 42).size, 2u);
+  ASSERT_EQ(jflect::write_to_buffer(buffer, -3.3).size, std::size(jflect::write(-3.3)));
+}